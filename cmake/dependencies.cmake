@@ -219,6 +219,9 @@ if(MUSICA_ENABLE_CARMA AND MUSICA_BUILD_C_CXX_INTERFACE AND NOT MUSICA_USE_PREBU
   find_package(BLAS REQUIRED)
   find_package(LAPACK REQUIRED)
 
+  # Column batches step CARMA states on worker threads
+  find_package(Threads REQUIRED)
+
   FetchContent_Declare(carma
       GIT_REPOSITORY ${CARMA_GIT_REPOSITORY}
       GIT_TAG ${CARMA_GIT_TAG}
@@ -5,6 +5,8 @@
 // and includes functions for creating and deleting CARMA instances with C binding.
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -12,6 +14,7 @@ namespace musica
 {
   // Forward declarations for C interface types
   struct CCARMAParameters;
+  struct CARMASharedInstance;
 
   // Enumeration for particle shapes
   enum class ParticleShape
@@ -152,6 +155,8 @@ namespace musica
     double center;            // Center of the wavelength bin [m]
     double width;             // Width of the wavelength bin [m]
     bool do_emission = true;  // Flag to indicate if emission is considered for this bin
+
+    bool operator==(const CARMAWavelengthBin&) const = default;
   };
 
   // Structure defining an approach to particle swelling
@@ -159,6 +164,8 @@ namespace musica
   {
     ParticleSwellingAlgorithm algorithm = ParticleSwellingAlgorithm::NONE;        // Swelling algorithm
     ParticleSwellingComposition composition = ParticleSwellingComposition::NONE;  // Composition for swelling
+
+    bool operator==(const CARMASwellingApproach&) const = default;
   };
 
   // Structure representing a complex number
@@ -166,6 +173,8 @@ namespace musica
   {
     double real;       // Real part
     double imaginary;  // Imaginary part
+
+    bool operator==(const CARMAComplex&) const = default;
   };
 
   // Structure representing a CARMA group configuration
@@ -196,6 +205,8 @@ namespace musica
     std::vector<double> df;       // fractal dimension per bin
     double falpha = 1.0;          // fractal packing coefficient
     double neutral_volfrc = 0.0;  // neutral volume fraction for fractal particles
+
+    bool operator==(const CARMAGroupConfig&) const = default;
   };
 
   // Structure representing a CARMA element configuration
@@ -213,6 +224,8 @@ namespace musica
     std::vector<double> arat;                       // projected area ratio per bin
     double kappa = 0.0;                             // hygroscopicity parameter
     std::vector<std::vector<CARMAComplex>> refidx;  // wavelength-resolved refractive indices (n_ref_idx, n_wave)
+
+    bool operator==(const CARMAElementConfig&) const = default;
   };
 
   // Structure representing a CARMA solute configuration
@@ -223,6 +236,8 @@ namespace musica
     int ions = 0;        // number of ions the solute dissociates into
     double wtmol = 0.0;  // molar mass of the solute [kg/mol]
     double rho = 0.0;    // mass density of the solute [kg/m3]
+
+    bool operator==(const CARMASoluteConfig&) const = default;
   };
 
   // Structure representing a CARMA gas species configuration
@@ -237,6 +252,8 @@ namespace musica
     double ds_threshold =
         0.0;  // convergence criteria for gas saturation [0 : off; > 0 : fraction; < 0 : amount past 0 crossing]
     std::vector<std::vector<CARMAComplex>> refidx;  // wavelength-resolved refractive indices (n_ref_idx, n_wave)
+
+    bool operator==(const CARMAGasConfig&) const = default;
   };
 
   // Structure representing CARMA coagulation configuration
@@ -249,6 +266,8 @@ namespace musica
     double ck0 = 0.0;                                                           // collection efficiency constant (0.0 = off)
     double grav_e_coll0 = 0.0;  // gravitational collection efficiency constant (0.0 = off)
     bool use_ccd = false;       // use constant collection efficiency data
+
+    bool operator==(const CARMACoagulationConfig&) const = default;
   };
 
   // Structure representing CARMA growth configuration
@@ -256,6 +275,8 @@ namespace musica
   {
     int ielem = 0;  // element index to grow
     int igas = 0;   // gas index to grow from
+
+    bool operator==(const CARMAGrowthConfig&) const = default;
   };
 
   // Structure representing CARMA nucleation configuration
@@ -267,6 +288,8 @@ namespace musica
     double rlh_nuc = 0.0;                                                       // latent heat of nucleation [m2 s-2]
     int igas = 0;                                                               // gas index to nucleate from
     int ievp2elem = 0;  // element index to evaporate to (if applicable)
+
+    bool operator==(const CARMANucleationConfig&) const = default;
   };
 
   // Structure representing CARMA initialization configuration
@@ -298,6 +321,8 @@ namespace musica
     double gsticki = 0.93;      // accommodation coefficient for growth of ice
     double gstickl = 1.0;       // accommodation coefficient for growth of liquid
     double tstick = 1.0;        // accommodation coefficient temperature
+
+    bool operator==(const CARMAInitializationConfig&) const = default;
   };
 
   // Structure representing CARMA parameters
@@ -327,6 +352,8 @@ namespace musica
 
     // Initialization configuration
     CARMAInitializationConfig initialization;
+
+    bool operator==(const CARMAParameters&) const = default;
   };
 
   struct CARMAGroupProperties
@@ -372,12 +399,19 @@ namespace musica
   {
    public:
     /// @brief Constructor for CARMA
+    ///        CARMA objects created from equal parameters share one initialized Fortran CARMA instance,
+    ///        so the setup-time tables (coagulation kernels, optical properties, fall velocities, ...)
+    ///        are only calculated once while any of those objects is alive.
     /// @param params The CARMA parameters to initialize the model
     /// @throws std::runtime_error if the CARMA instance cannot be created
     explicit CARMA(const CARMAParameters& params);
 
     ~CARMA();
 
+    /// @brief Get the number of initialized CARMA instances currently shared through the setup cache
+    /// @return The number of distinct CARMA configurations with at least one live CARMA object
+    static std::size_t NumberOfCachedInstances();
+
     /// @brief Get the version of CARMA
     /// @return The version string of the CARMA instance
     static std::string GetVersion();
@@ -408,11 +442,12 @@ namespace musica
     CARMAElementProperties GetElementProperties(int element_index) const;
 
     /// @brief Convert CARMAParameters to C-compatible CCARMAParameters
+    ///        The structure and all of its nested arrays are placed in a single allocation.
     /// @param params The C++ CARMA parameters to convert
-    /// @return The C-compatible CARMA parameters structure
+    /// @return The C-compatible CARMA parameters structure, to be released with FreeCCompatible
     static struct CCARMAParameters* ToCCompatible(const CARMAParameters& params);
 
-    /// @brief Free memory allocated in CCARMAParameters
+    /// @brief Free the allocation created by ToCCompatible
     /// @param c_params The C-compatible parameters to clean up
     static void FreeCCompatible(struct CCARMAParameters* c_params);
 
@@ -421,9 +456,10 @@ namespace musica
     static CARMAParameters CreateAluminumTestParams();
 
    private:
-    CARMAParameters carma_parameters_;      // C++ parameters
-    CCARMAParameters* c_carma_parameters_;  // C-compatible parameters
-    void* f_carma_type_ = nullptr;          // Pointer to the Fortran CARMA type
+    CARMAParameters carma_parameters_;                      // C++ parameters
+    std::shared_ptr<CARMASharedInstance> shared_instance_;  // Fortran CARMA instance shared by equal parameters
+    CCARMAParameters* c_carma_parameters_;                  // C-compatible parameters (owned by shared_instance_)
+    void* f_carma_type_ = nullptr;                          // Pointer to the Fortran CARMA type (owned by shared_instance_)
   };
 
 }  // namespace musica
\ No newline at end of file
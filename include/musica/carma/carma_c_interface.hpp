@@ -325,6 +325,12 @@ namespace musica
         const CCARMAParameters& carma_params,
         const CARMAStateParametersC& state_params,
         int* rc);
+    void InternalResetCarmaState(
+        void* carma_state_instance,
+        void* carma_instance,
+        const CCARMAParameters& carma_params,
+        const CARMAStateParametersC& state_params,
+        int* rc);
     void InternalDestroyCarmaState(void* carma_state_instance, int* rc);
 
     void InternalSetBin(
@@ -413,6 +419,37 @@ namespace musica
         double* weight_pct_aerosol_composition,
         int* rc);
 
+    void InternalGetBins(
+        void* carma_state_instance,
+        int nz,
+        int nbin,
+        int nelem,
+        double* profiles,
+        double* fall_velocity,
+        double* surface_values,
+        int* rc);
+    void InternalSetBins(
+        void* carma_state_instance,
+        int nz,
+        int nbin,
+        int nelem,
+        const double* values,
+        const double* surface_mass,
+        int* rc);
+    void InternalGetGases(void* carma_state_instance, int nz, int ngas, double* values, int* rc);
+    void InternalSetGases(
+        void* carma_state_instance,
+        int nz,
+        int ngas,
+        const double* values,
+        const double* old_mmr,
+        int old_mmr_size,
+        const double* gas_saturation_wrt_ice,
+        int gas_saturation_wrt_ice_size,
+        const double* gas_saturation_wrt_liquid,
+        int gas_saturation_wrt_liquid_size,
+        int* rc);
+
     void InternalGetEnvironmentalValues(
         void* carma_state_instance,
         int nz,
@@ -0,0 +1,81 @@
+// Copyright (C) 2023-2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// This file contains the definition of the CARMA column batch class. A batch owns one
+// CARMA state per column and steps the columns concurrently on a pool of worker threads
+#pragma once
+
+#include <musica/carma/carma_state.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace musica
+{
+  class CARMA;
+
+  /// @brief A set of CARMA columns that are stepped concurrently
+  ///
+  /// Thread safety: with more than one worker thread, Step calls into CARMA and the musica CARMA
+  /// interface from several threads at once, one column state per thread. The Fortran sources are
+  /// compiled with the compiler's recursive option (e.g. -frecursive), which puts procedure locals
+  /// on each thread's stack. That option does not cover module variables or initialized local
+  /// declarations (which are implicitly SAVE'd), and it has not been established that the CARMA
+  /// library keeps no such mutable state while stepping. Batches therefore default to a single
+  /// worker thread, and more threads are an opt-in for CARMA builds known to be reentrant.
+  /// A batch itself is not thread-safe: do not call Step, GetColumn, or GetStepStatistics on the
+  /// same batch from more than one thread at a time.
+  class CARMAColumnBatch
+  {
+   public:
+    /// @brief Create one CARMA state per column from a single CARMA instance
+    /// @param carma The CARMA instance shared by all columns
+    /// @param column_params The state parameters for each column
+    /// @param number_of_threads The number of worker threads used to step the columns
+    ///        (0: use the number of hardware threads; always capped at the number of columns)
+    /// @throws std::invalid_argument if no columns are provided
+    CARMAColumnBatch(
+        const CARMA& carma,
+        const std::vector<CARMAStateParameters>& column_params,
+        std::size_t number_of_threads = 1);
+
+    /// @brief Get the number of columns in the batch
+    std::size_t NumberOfColumns() const
+    {
+      return columns_.size();
+    }
+
+    /// @brief Get the number of worker threads used to step the columns
+    std::size_t NumberOfThreads() const
+    {
+      return number_of_threads_;
+    }
+
+    /// @brief Get the state of a single column, e.g. to set or retrieve bin and gas values
+    /// @param column_index The index of the column
+    /// @throws std::out_of_range if the column index is out of range
+    CARMAState& GetColumn(std::size_t column_index);
+    const CARMAState& GetColumn(std::size_t column_index) const;
+
+    /// @brief Advance every column by one time step using the same step configuration
+    /// @param step_config The step configuration applied to all columns
+    void Step(CARMAStateStepConfig& step_config);
+
+    /// @brief Advance every column by one time step using a step configuration per column
+    ///        Contiguous ranges of columns are stepped on each worker thread. If any column
+    ///        fails, the first error is rethrown after all workers have finished.
+    /// @param step_configs The step configuration for each column
+    /// @throws std::invalid_argument if the number of configurations does not match the number of columns
+    void Step(std::vector<CARMAStateStepConfig>& step_configs);
+
+    /// @brief Get the statistics of the last step for each column
+    /// @return The step statistics, indexed by column
+    std::vector<CarmaStatistics> GetStepStatistics() const;
+
+   private:
+    std::vector<std::unique_ptr<CARMAState>> columns_;
+    std::size_t number_of_threads_;
+  };
+
+}  // namespace musica
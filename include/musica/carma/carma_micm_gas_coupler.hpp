@@ -0,0 +1,100 @@
+// Copyright (C) 2023-2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// This file contains the definition of the CARMA-MICM gas coupler, which exchanges gas
+// mixing ratios between a CARMA column and the grid cells of a MICM state
+#pragma once
+
+#include <musica/carma/carma.hpp>
+#include <musica/carma/carma_state.hpp>
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace musica
+{
+  class MICM;
+  class State;
+
+  /// @brief A link between a CARMA gas and a MICM species
+  struct CARMAMICMGasLink
+  {
+    std::string carma_gas;     // Name of the CARMA gas
+    std::string micm_species;  // Name of the MICM species
+  };
+
+  class CARMAMICMGasCoupler
+  {
+   public:
+    /// @brief Link CARMA gases to MICM species by name
+    /// @param carma The CARMA instance the coupled states are created from
+    /// @param micm The MICM solver the coupled states are created from
+    /// @param links The CARMA gas and MICM species pairs to exchange
+    /// @throws std::invalid_argument if a gas or species is not found or a gas has no molecular weight
+    CARMAMICMGasCoupler(const CARMA& carma, const MICM& micm, const std::vector<CARMAMICMGasLink>& links);
+
+    /// @brief Link CARMA gases to MICM species by gas composition (e.g. H2O, H2SO4, SO2)
+    /// @param carma The CARMA instance the coupled states are created from
+    /// @param micm The MICM solver the coupled states are created from
+    /// @param species_by_composition The MICM species name for each CARMA gas composition to exchange
+    /// @throws std::invalid_argument if no CARMA gas has a requested composition
+    CARMAMICMGasCoupler(
+        const CARMA& carma,
+        const MICM& micm,
+        const std::map<GasComposition, std::string>& species_by_composition);
+
+    /// @brief Get the number of linked gases
+    std::size_t NumberOfLinks() const
+    {
+      return links_.size();
+    }
+
+    /// @brief Copy the linked MICM concentrations into the CARMA gas mass mixing ratios
+    ///        CARMA vertical center k is exchanged with MICM grid cell first_grid_cell + k.
+    ///        Concentrations [mol m-3] are converted to mass mixing ratios [kg kg-1] using the
+    ///        CARMA air density. Unlinked CARMA gases keep their current values.
+    /// @param micm_state The MICM state to read concentrations from
+    /// @param first_grid_cell The MICM grid cell of the lowest CARMA vertical center
+    /// @param carma_state The CARMA state to update
+    /// @throws std::out_of_range if the column does not fit in the MICM state
+    void MICMToCARMA(State& micm_state, std::size_t first_grid_cell, CARMAState& carma_state);
+
+    /// @brief Copy the linked CARMA gas mass mixing ratios into the MICM concentrations
+    /// @param carma_state The CARMA state to read gas mass mixing ratios from
+    /// @param micm_state The MICM state to update
+    /// @param first_grid_cell The MICM grid cell of the lowest CARMA vertical center
+    /// @throws std::out_of_range if the column does not fit in the MICM state
+    void CARMAToMICM(const CARMAState& carma_state, State& micm_state, std::size_t first_grid_cell);
+
+    /// @brief Exchange the linked gases around one CARMA step
+    ///        The MICM concentrations are copied into CARMA, the column is stepped, and the
+    ///        updated gases are copied back into the MICM state.
+    /// @param carma_state The CARMA state to step
+    /// @param step_config The CARMA step configuration
+    /// @param micm_state The MICM state holding the gas-phase concentrations
+    /// @param first_grid_cell The MICM grid cell of the lowest CARMA vertical center
+    void Step(CARMAState& carma_state, CARMAStateStepConfig& step_config, State& micm_state, std::size_t first_grid_cell);
+
+   private:
+    struct Link
+    {
+      std::size_t carma_gas_index;     // Position of the gas in the CARMA gas arrays
+      std::size_t micm_species_index;  // Position of the species in the MICM state variables
+      double molecular_weight;         // Molecular weight of the gas [kg mol-1]
+    };
+
+    void LoadCarmaValues(const CARMAState& carma_state, State& micm_state, std::size_t first_grid_cell);
+    std::size_t ConcentrationIndex(std::size_t grid_cell, std::size_t species_index) const;
+
+    std::vector<Link> links_;
+    std::size_t number_of_species_;
+    std::size_t vector_size_;
+    std::size_t nz_;
+    std::size_t ngas_;
+    std::vector<double> gas_values_;            // [CarmaGasField][gas][vertical center], reused between calls
+    std::vector<double> environmental_values_;  // [CarmaEnvironmentalField][vertical center], reused between calls
+  };
+
+}  // namespace musica
@@ -63,6 +63,22 @@ namespace musica
     CARMASurfaceProperties ice;      // Surface properties for ice
   };
 
+  // Interface-level timers and counters collected by a CARMA state while timing is enabled (see
+  // CARMAState::EnableTiming). These measure time at the boundary of the CARMA library only: the
+  // whole CARMA step, and time moving values into and out of the CARMA state. They are not
+  // per-process timers. CARMA runs coagulation, growth, sedimentation, and its other processes
+  // inside a single step call, and timing them one by one would need instrumentation in the
+  // CARMA library itself.
+  struct CarmaTimingStatistics
+  {
+    bool enabled = false;        // Whether timers and counters are being collected
+    int number_of_steps = 0;     // Number of steps taken since timing was enabled or reset
+    double step_time = 0.0;      // Wall time spent in CARMA steps [s]
+    double max_step_time = 0.0;  // Longest wall time of a single CARMA step [s]
+    double set_time = 0.0;       // Wall time spent setting values in the CARMA state [s]
+    double get_time = 0.0;       // Wall time spent getting values from the CARMA state [s]
+  };
+
   struct CarmaStatistics
   {
     int max_number_of_substeps;      // Maximum number of substeps taken in the last run
@@ -73,6 +89,7 @@ namespace musica
     std::vector<double> z_substeps;  // number of substeps per vertical level
     double xc;                       // x location at the center of this CARMA state
     double yc;                       // y location at the center of this CARMA state
+    CarmaTimingStatistics timing;    // Timers and counters accumulated since timing was enabled or reset
   };
 
   struct CarmaBinValues
@@ -93,6 +110,53 @@ namespace musica
     std::vector<double> total_mass_mixing_ratio;     // kg m-3
   };
 
+  // Fields of the per-level bulk bin array filled by CARMAState::GetBins
+  enum class CarmaBinProfileField
+  {
+    MASS_MIXING_RATIO = 0,           // [kg kg-1]
+    NUMBER_MIXING_RATIO = 1,         // [# kg-1]
+    NUMBER_DENSITY = 2,              // [# m-3]
+    NUCLEATION_RATE = 3,             // [# m-3 s-1]
+    WET_PARTICLE_RADIUS = 4,         // [m]
+    WET_PARTICLE_DENSITY = 5,        // [kg m-3]
+    DRY_PARTICLE_DENSITY = 6,        // [kg m-3]
+    DELTA_PARTICLE_TEMPERATURE = 7,  // [K]
+    KAPPA = 8,                       // hygroscopicity parameter
+    TOTAL_MASS_MIXING_RATIO = 9,     // [kg m-3]
+    NUMBER_OF_FIELDS = 10
+  };
+
+  // Fields of the per-bin bulk surface array filled by CARMAState::GetBins
+  enum class CarmaBinSurfaceField
+  {
+    PARTICLE_MASS_ON_SURFACE = 0,  // [kg m-2]
+    SEDIMENTATION_FLUX = 1,        // [kg m-2 s-1]
+    DEPOSITION_VELOCITY = 2,       // [m s-1]
+    NUMBER_OF_FIELDS = 3
+  };
+
+  // Fields of the bulk gas array filled by CARMAState::GetGases
+  enum class CarmaGasField
+  {
+    MASS_MIXING_RATIO = 0,               // [kg kg-1]
+    GAS_SATURATION_WRT_ICE = 1,          // [fraction]
+    GAS_SATURATION_WRT_LIQUID = 2,       // [fraction]
+    GAS_VAPOR_PRESSURE_WRT_ICE = 3,      // [Pa]
+    GAS_VAPOR_PRESSURE_WRT_LIQUID = 4,   // [Pa]
+    WEIGHT_PCT_AEROSOL_COMPOSITION = 5,  // [weight %]
+    NUMBER_OF_FIELDS = 6
+  };
+
+  // Fields of the bulk environmental array filled by CARMAState::GetEnvironmentalValues
+  enum class CarmaEnvironmentalField
+  {
+    TEMPERATURE = 0,  // [K]
+    PRESSURE = 1,     // [Pa]
+    AIR_DENSITY = 2,  // [kg m-3]
+    LATENT_HEAT = 3,  // [K s-1]
+    NUMBER_OF_FIELDS = 4
+  };
+
   struct CarmaDetrainValues
   {
     std::vector<double> mass_mixing_ratio;     // Mass mixing ratio for detrainment [kg kg-1]
@@ -127,6 +191,13 @@ namespace musica
 
     ~CARMAState();
 
+    /// @brief Load a new column into the existing state, reusing its allocation
+    ///        The time, coordinates and environmental profiles are replaced. As for a newly
+    ///        created state, the bin, detrained and gas values must be set before stepping.
+    /// @param params The state parameters of the new column
+    /// @throws std::invalid_argument if the profile sizes do not match the CARMA dimensions
+    void Reset(const CARMAStateParameters& params);
+
     /// @brief Set the values for a specific bin and element
     /// @param bin_index The index of the bin
     /// @param element_index The index of the particle element
@@ -152,12 +223,48 @@ namespace musica
         const std::vector<double>& old_mmr,
         const std::vector<double>& gas_saturation_wrt_ice,
         const std::vector<double>& gas_saturation_wrt_liquid);
+
+    /// @brief Set the mixing ratios of every bin and particle element in one call
+    /// @param values Bin mixing ratios [kg/kg] as a contiguous [element][bin][vertical center] array
+    /// @param surface_mass Element masses on the surface [kg m-2] as a contiguous [element][bin] array
+    void SetBins(const double* values, const double* surface_mass);
+
+    /// @brief Set the profiles of every gas in one call
+    /// @param values Mass mixing ratios [kg/kg] as a contiguous [gas][vertical center] array
+    /// @param old_mmr Original mass mixing ratios [kg/kg], [gas][vertical center] (nullptr: not set)
+    /// @param gas_saturation_wrt_ice Gas saturation with respect to ice [fraction], [gas][vertical center]
+    ///        (nullptr: not set)
+    /// @param gas_saturation_wrt_liquid Gas saturation with respect to liquid [fraction], [gas][vertical center]
+    ///        (nullptr: not set)
+    void SetGases(
+        const double* values,
+        const double* old_mmr = nullptr,
+        const double* gas_saturation_wrt_ice = nullptr,
+        const double* gas_saturation_wrt_liquid = nullptr);
+
     CarmaStatistics GetStepStatistics() const;
     CarmaBinValues GetBinValues(int bin_index, int element_index) const;
     CarmaDetrainValues GetDetrain(int bin_index, int element_index) const;
     CarmaGasValues GetGas(int gas_index) const;
     CarmaEnvironmentalValues GetEnvironmentalValues() const;
 
+    /// @brief Get the environmental values in one call
+    /// @param values Environmental values as a contiguous [CarmaEnvironmentalField][vertical center] array,
+    ///        provided by the caller
+    void GetEnvironmentalValues(double* values) const;
+
+    /// @brief Get the values of every bin and particle element in one call
+    ///        Units match those of GetBinValues. The arrays are provided by the caller
+    ///        and can be reused between steps.
+    /// @param profiles Per-level values as a contiguous [CarmaBinProfileField][element][bin][vertical center] array
+    /// @param fall_velocity Fall velocities [m s-1] as a contiguous [element][bin][vertical level] array
+    /// @param surface_values Per-bin values as a contiguous [CarmaBinSurfaceField][element][bin] array
+    void GetBins(double* profiles, double* fall_velocity, double* surface_values) const;
+
+    /// @brief Get the values of every gas in one call
+    /// @param values Gas values as a contiguous [CarmaGasField][gas][vertical center] array, provided by the caller
+    void GetGases(double* values) const;
+
     /// @brief Set the temperature profile
     /// @param temperature The temperature profile [K] (number of vertical centers)
     void SetTemperature(const std::vector<double>& temperature);
@@ -167,9 +274,43 @@ namespace musica
     void SetAirDensity(const std::vector<double>& air_density);
     void Step(CARMAStateStepConfig& step_config);
 
+    /// @brief Enable or disable collection of interface-level timers and counters, reported by GetStepStatistics
+    ///        (see CarmaTimingStatistics; microphysical processes are not timed individually)
+    /// @param enabled Whether to collect timers and counters
+    void EnableTiming(bool enabled);
+
+    /// @brief Reset the timers and counters to zero
+    void ResetTiming();
+
+    int GetNumberOfVerticalCenters() const
+    {
+      return nz;
+    }
+
+    int GetNumberOfBins() const
+    {
+      return nbin;
+    }
+
+    int GetNumberOfElements() const
+    {
+      return nelem;
+    }
+
+    int GetNumberOfGases() const
+    {
+      return ngas;
+    }
+
    private:
+    const CARMA* carma_;  // CARMA instance the state was created from
     void* f_carma_state_;
-    int nz;  // Number of vertical levels
+    int nz;     // Number of vertical levels
+    int nbin;   // Number of particle bins
+    int nelem;  // Number of particle elements
+    int ngas;   // Number of gases
+
+    mutable CarmaTimingStatistics timing_;  // Timers and counters (updated by const getters)
   };
 
 }  // namespace musica
\ No newline at end of file
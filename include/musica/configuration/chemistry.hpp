@@ -3,6 +3,10 @@
 #include <micm/process/process.hpp>
 #include <micm/system/system.hpp>
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 namespace musica
 {
   struct Chemistry
@@ -10,4 +14,12 @@ namespace musica
     micm::System system;
     std::vector<micm::Process> processes;
   };
+
+  /// @brief The converted species and phases of a mechanism, keyed by name, so that other
+  ///        builders (e.g. MIAM) can reuse them instead of converting the mechanism again
+  struct ChemistryTables
+  {
+    std::unordered_map<std::string, micm::Species> species;
+    std::unordered_map<std::string, micm::Phase> phases;
+  };
 }  // namespace musica
\ No newline at end of file
@@ -13,6 +13,12 @@ namespace musica
 {
   Chemistry ConvertChemistry(const mechanism_configuration::Mechanism& mechanism);
 
+  /// @brief Convert a mechanism and keep its converted species and phases
+  /// @param mechanism The parsed mechanism
+  /// @param tables Filled with every species and phase of the mechanism, keyed by name
+  /// @return The gas-phase chemistry, built from the same species and phases as the tables
+  Chemistry ConvertChemistry(const mechanism_configuration::Mechanism& mechanism, ChemistryTables& tables);
+
   // Utility functions to check types and perform conversions
   bool IsBool(const std::string& value);
   bool IsInt(const std::string& value);
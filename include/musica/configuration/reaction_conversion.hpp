@@ -0,0 +1,56 @@
+// Copyright (C) 2023-2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// This file contains helpers shared by the mechanism converters (ConvertChemistry and
+// ReduceMechanism): traits that detect the members of a reaction type, and the conversion
+// of reaction configurations to MICM rate constant parameters
+#pragma once
+
+#include <mechanism_configuration/types/reactions.hpp>
+#include <micm/Process.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace musica
+{
+  // Helper traits to detect the presence of reactants, products, and scaling factor members
+  template<typename T, typename = void>
+  struct has_reactants : std::false_type
+  {
+  };
+
+  template<typename T>
+  struct has_reactants<T, std::void_t<decltype(std::declval<T>().reactants)>> : std::true_type
+  {
+  };
+
+  template<typename T, typename = void>
+  struct has_products : std::false_type
+  {
+  };
+
+  template<typename T>
+  struct has_products<T, std::void_t<decltype(std::declval<T>().products)>> : std::true_type
+  {
+  };
+
+  template<typename T, typename = void>
+  struct has_scaling_factor : std::false_type
+  {
+  };
+
+  template<typename T>
+  struct has_scaling_factor<T, std::void_t<decltype(std::declval<T>().scaling_factor)>> : std::true_type
+  {
+  };
+
+  /// @brief Convert a reaction configuration to its MICM rate constant parameters
+  /// @throws musica::Exception if the configuration cannot be represented in MICM
+  micm::ArrheniusRateConstantParameters ToMicmParameters(const mechanism_configuration::types::Arrhenius& reaction);
+  micm::TroeRateConstantParameters ToMicmParameters(const mechanism_configuration::types::Troe& reaction);
+  micm::TernaryChemicalActivationRateConstantParameters ToMicmParameters(
+      const mechanism_configuration::types::TernaryChemicalActivation& reaction);
+  micm::TunnelingRateConstantParameters ToMicmParameters(const mechanism_configuration::types::Tunneling& reaction);
+  micm::TaylorSeriesRateConstantParameters ToMicmParameters(const mechanism_configuration::types::TaylorSeries& reaction);
+}  // namespace musica
@@ -0,0 +1,74 @@
+// Copyright (C) 2023-2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Optional mechanism reduction stage that sits between parsing a mechanism and
+// building a MICM solver. A directed relation graph (DRG) is built from reaction
+// rates evaluated at a set of sample conditions, and only the species strongly
+// coupled to a set of target species (and the reactions among them) are kept.
+#pragma once
+
+#include <musica/configuration/chemistry.hpp>
+
+#include <mechanism_configuration/mechanism.hpp>
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace musica
+{
+  /// @brief A sample of atmospheric conditions used to weight the relation graph
+  struct ReductionConditions
+  {
+    double temperature{ 0.0 };  // [K]
+    double pressure{ 0.0 };     // [Pa]
+    double air_density{ 0.0 };  // [mol m-3]
+    /// @brief Species concentrations [mol m-3]; species not listed are treated as zero
+    std::unordered_map<std::string, double> concentrations;
+    /// @brief Rate parameters for reactions whose rate constants are supplied by the host,
+    ///        keyed by their MICM label (e.g. "PHOTO.jo2_b", "USER.foo", "Lambda.baz")
+    std::unordered_map<std::string, double> rate_parameters;
+  };
+
+  /// @brief Options for the directed relation graph reduction
+  struct ReductionOptions
+  {
+    /// @brief Species whose evolution must be preserved
+    std::vector<std::string> target_species;
+    /// @brief Conditions at which reaction rates are evaluated
+    std::vector<ReductionConditions> sample_conditions;
+    /// @brief Species whose maximum coupling coefficient to the retained set falls below this value are removed
+    double threshold{ 0.01 };
+  };
+
+  /// @brief Result of reducing a mechanism
+  struct ReducedChemistry
+  {
+    /// @brief The reduced mechanism (species, phases, and reactions filtered)
+    mechanism_configuration::Mechanism mechanism;
+    /// @brief The reduced mechanism converted for MICM
+    Chemistry chemistry;
+    /// @brief Names of the species removed from the mechanism
+    std::vector<std::string> removed_species;
+    /// @brief Number of reactions removed from the mechanism
+    std::size_t number_of_removed_reactions{ 0 };
+    /// @brief Largest relative change in the net tendency of any target species over all
+    ///        sample conditions caused by removing reactions
+    double error_estimate{ 0.0 };
+  };
+
+  /// @brief Reduce a mechanism with a directed relation graph pass
+  ///
+  /// Reactions whose rate constants cannot be evaluated from the sample conditions
+  /// (e.g. photolysis or user-defined reactions without an entry in rate_parameters)
+  /// are always retained along with their species, as are branched and surface
+  /// reactions. Third-body species, species with a fixed concentration or mixing ratio,
+  /// and species in non-gas phases are never removed.
+  ///
+  /// @param mechanism The parsed mechanism
+  /// @param options Target species, sample conditions, and threshold
+  /// @return The reduced mechanism and chemistry, with an error estimate
+  /// @throws std::invalid_argument if no target species are given
+  ReducedChemistry ReduceMechanism(const mechanism_configuration::Mechanism& mechanism, const ReductionOptions& options);
+}  // namespace musica
@@ -5,8 +5,10 @@
 #include <musica/tuvx/grid.hpp>
 #include <musica/utils/util.hpp>
 
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace musica
@@ -41,6 +43,19 @@ namespace musica
     /// @return a grid pointer
     Grid *GetGrid(const char *grid_name, const char *grid_units, Error *error);
 
+    /// @brief Returns a grid that is resolved once and cached by the map
+    ///
+    /// Repeated calls with the same key return the same wrapper without calling into TUV-x. The
+    /// wrapper is owned by the map and must not be deleted. Its data pointers (e.g.
+    /// Grid::GetEdgesPointer) stay valid for the life of the grid, so hosts can resolve them once
+    /// and update values in place every step. Resolved grids are released when the map is
+    /// destroyed or when any grid is removed from it.
+    /// @param grid_name The name of the grid we want
+    /// @param grid_units The units of the grid we want
+    /// @param error The error struct to indicate success or failure
+    /// @return a grid pointer owned by the map
+    Grid *ResolveGrid(const char *grid_name, const char *grid_units, Error *error);
+
     /// @brief Gets a grid by index in the map
     /// @param index The index of the grid we want
     /// @param error The error struct to indicate success or failure
@@ -66,6 +81,7 @@ namespace musica
    private:
     void *grid_map_;
     bool owns_grid_map_;
+    std::map<std::pair<std::string, std::string>, std::unique_ptr<Grid>> resolved_grids_;
 
     friend class TUVX;
   };
@@ -102,6 +118,14 @@ namespace musica
     /// @return The grid pointer, or nullptr if the grid is not found
     Grid *GetGrid(GridMap *grid_map, const char *grid_name, const char *grid_units, Error *error);
 
+    /// @brief Returns a grid that is resolved once and cached by the grid map
+    /// @param grid_map The grid map to resolve the grid from
+    /// @param grid_name The name of the grid we want
+    /// @param grid_units The units of the grid we want
+    /// @param error The error struct to indicate success or failure
+    /// @return a grid pointer owned by the map, or nullptr if the grid is not found
+    Grid *ResolveGrid(GridMap *grid_map, const char *grid_name, const char *grid_units, Error *error);
+
     /// @brief Returns a grid by index from the grid map
     /// @param grid_map The grid map to get the grid from
     /// @param index The index of the grid we want
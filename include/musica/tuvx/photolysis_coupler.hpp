@@ -0,0 +1,89 @@
+// Copyright (C) 2023-2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// This file defines the PhotolysisCoupler class, which copies TUV-x photolysis rate constants
+// directly into the user-defined rate parameters of a MICM State.
+#pragma once
+
+#include <musica/micm/state.hpp>
+#include <musica/tuvx/tuvx.hpp>
+#include <musica/utils/error.hpp>
+#include <musica/utils/util.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace musica
+{
+  /// @brief How photolysis rate constants on TUV-x vertical edges are mapped to MICM grid cells (vertical midpoints)
+  enum class EdgeToMidpointRule
+  {
+    Average,    // Mean of the edges bounding the layer
+    LowerEdge,  // Value at the bottom edge of the layer
+    UpperEdge   // Value at the top edge of the layer
+  };
+
+  /// @brief Maps one TUV-x photolysis reaction to one MICM rate parameter
+  struct PhotolysisReactionMapping
+  {
+    std::string tuvx_label;    // TUV-x photolysis rate constant label (e.g. "O2+hv->O+O")
+    std::string micm_label;    // MICM rate parameter label (e.g. "PHOTO.jo2_b")
+    double scale_factor{ 1.0 };
+  };
+
+  /// @brief Scatters TUV-x photolysis rate constants into the rate parameters of a MICM State
+  ///
+  /// Each TUV-x layer is one MICM grid cell, with the bottom layer at the first grid cell of the
+  /// column. Label lookups and State strides are resolved once at construction, so each update
+  /// writes straight into the State's (standard- or vector-ordered) rate parameter buffer.
+  class PhotolysisCoupler
+  {
+   public:
+    /// @brief Creates a coupler between a TUV-x calculator and MICM States with the layout of the given State
+    /// @param tuvx TUV-x calculator that provides the photolysis rate constants
+    /// @param state State whose rate parameter layout will be used for every update
+    /// @param reactions Reactions to couple
+    /// @param rule Rule for mapping edge values to grid cells
+    /// @throws std::runtime_error if a label is not found in TUV-x or the State
+    PhotolysisCoupler(
+        TUVX &tuvx,
+        State &state,
+        const std::vector<PhotolysisReactionMapping> &reactions,
+        EdgeToMidpointRule rule = EdgeToMidpointRule::Average);
+
+    /// @brief Runs TUV-x for one column and updates the photolysis rate parameters of its grid cells
+    /// @param solar_zenith_angle Solar zenith angle [radians]
+    /// @param earth_sun_distance Earth-Sun distance [AU]
+    /// @param state State to update (must have the layout of the State used to create the coupler)
+    /// @param first_grid_cell Grid cell in the State that holds the bottom layer of the column
+    /// @param error Error struct to indicate success or failure
+    void Run(
+        const double solar_zenith_angle,
+        const double earth_sun_distance,
+        State &state,
+        const std::size_t first_grid_cell,
+        Error *const error);
+
+    /// @brief Updates the photolysis rate parameters of a column's grid cells from TUV-x output
+    /// @param photolysis_rate_constants Photolysis rate constants [s^-1] (reaction, vertical edge) as returned by
+    /// TUVX::Run
+    /// @param state State to update (must have the layout of the State used to create the coupler)
+    /// @param first_grid_cell Grid cell in the State that holds the bottom layer of the column
+    /// @param error Error struct to indicate success or failure
+    void Scatter(
+        const double *const photolysis_rate_constants,
+        State &state,
+        const std::size_t first_grid_cell,
+        Error *const error) const;
+
+   private:
+    TUVX &tuvx_;
+    std::vector<IndexMapping> mappings_;  // TUV-x reaction index -> MICM rate parameter index
+    EdgeToMidpointRule rule_;
+    std::size_t number_of_layers_;
+    std::size_t number_of_rate_parameters_;
+    std::size_t vector_size_;  // 1 for standard-ordered States
+    std::vector<double> photolysis_rate_constants_;
+  };
+}  // namespace musica
@@ -0,0 +1,83 @@
+// Copyright (C) 2023-2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// This file defines the PhotolysisInterpolator class, which serves photolysis rate constants
+// at chemistry times between TUV-x radiative transfer calls.
+#pragma once
+
+#include <musica/tuvx/tuvx.hpp>
+#include <musica/utils/error.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+namespace musica
+{
+  /// @brief Interpolates TUV-x photolysis rate constants in time between radiative transfer calls
+  ///
+  /// Snapshots of the photolysis rate constants are kept at the times TUV-x was run. Rates at an
+  /// intermediate time are interpolated linearly in time after normalizing each snapshot by the
+  /// cosine of its solar zenith angle, and are then scaled by the cosine of the solar zenith angle
+  /// at the requested time. This follows the diurnal cycle much more closely than holding rates
+  /// constant between calls. With the sun near or below the horizon, where the cosine no longer
+  /// describes the rates, the snapshots are blended linearly in time instead. Rates are zero at and
+  /// beyond the night threshold of the TUV-x calculator (TUVX::GetNightThreshold), as in TUVX::Run.
+  class PhotolysisInterpolator
+  {
+   public:
+    /// @brief Creates an interpolator for the photolysis rate constants of a TUV-x calculator
+    /// @param tuvx TUV-x calculator that provides the photolysis rate constants
+    /// @param max_snapshots Number of most recent snapshots to keep (at least 2)
+    /// @throws std::runtime_error if the output sizes cannot be determined
+    PhotolysisInterpolator(TUVX &tuvx, const std::size_t max_snapshots = 2);
+
+    /// @brief Runs TUV-x and stores the photolysis rate constants as a new snapshot
+    /// @param time Model time of the snapshot [s]; must be later than the last snapshot
+    /// @param solar_zenith_angle Solar zenith angle at the snapshot time [radians]
+    /// @param earth_sun_distance Earth-Sun distance [AU]
+    /// @param error Error struct to indicate success or failure
+    void Update(const double time, const double solar_zenith_angle, const double earth_sun_distance, Error *const error);
+
+    /// @brief Stores photolysis rate constants calculated by the caller as a new snapshot
+    /// @param time Model time of the snapshot [s]; must be later than the last snapshot
+    /// @param solar_zenith_angle Solar zenith angle at the snapshot time [radians]
+    /// @param photolysis_rate_constants Photolysis rate constants [s^-1] (reaction, vertical edge)
+    /// @param error Error struct to indicate success or failure
+    void AddSnapshot(
+        const double time,
+        const double solar_zenith_angle,
+        const double *const photolysis_rate_constants,
+        Error *const error);
+
+    /// @brief Interpolates photolysis rate constants to a model time
+    ///
+    /// Times outside the stored snapshots use the nearest snapshot, scaled by the cosine of the
+    /// solar zenith angle at the requested time, or held as is with the sun near or below the horizon.
+    /// @param time Model time [s]
+    /// @param solar_zenith_angle Solar zenith angle at the requested time [radians]
+    /// @param photolysis_rate_constants Photolysis rate constants [s^-1] (reaction, vertical edge)
+    /// @param error Error struct to indicate success or failure
+    void Interpolate(
+        const double time,
+        const double solar_zenith_angle,
+        double *const photolysis_rate_constants,
+        Error *const error) const;
+
+    /// @brief Returns the number of stored snapshots
+    std::size_t NumberOfSnapshots() const;
+
+   private:
+    struct Snapshot
+    {
+      double time;
+      double cosine_solar_zenith_angle;  // clamped to be non-negative
+      std::vector<double> photolysis_rate_constants;
+    };
+
+    TUVX &tuvx_;
+    std::size_t max_snapshots_;
+    std::size_t photolysis_size_;
+    std::deque<Snapshot> snapshots_;
+  };
+}  // namespace musica
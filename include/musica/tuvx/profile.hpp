@@ -113,6 +113,7 @@ namespace musica
     void* updater_;
 
     friend class ProfileMap;
+    friend class TUVX;
 
     /// @brief Wraps an existing profile instance
     /// @param updater The updater for the profile
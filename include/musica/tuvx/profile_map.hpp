@@ -6,8 +6,10 @@
 #include <musica/tuvx/profile_map.hpp>
 #include <musica/utils/util.hpp>
 
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace musica
@@ -42,6 +44,19 @@ namespace musica
     /// @return a profile pointer
     Profile *GetProfile(const char *profile_name, const char *profile_units, Error *error);
 
+    /// @brief Returns a profile that is resolved once and cached by the map
+    ///
+    /// Repeated calls with the same key return the same wrapper without calling into TUV-x. The
+    /// wrapper is owned by the map and must not be deleted. Its data pointers (e.g.
+    /// Profile::GetEdgeValuesPointer) stay valid for the life of the profile, so hosts can resolve them once
+    /// and update values in place every step. Resolved profiles are released when the map is
+    /// destroyed or when any profile is removed from it.
+    /// @param profile_name The name of the profile we want
+    /// @param profile_units The units of the profile we want
+    /// @param error The error struct to indicate success or failure
+    /// @return a profile pointer owned by the map
+    Profile *ResolveProfile(const char *profile_name, const char *profile_units, Error *error);
+
     /// @brief Returns a profile by index in the map
     /// @param index The index of the profile we want
     /// @param error The error struct to indicate success or failure
@@ -67,6 +82,7 @@ namespace musica
    private:
     void *profile_map_;
     bool owns_profile_map_;
+    std::map<std::pair<std::string, std::string>, std::unique_ptr<Profile>> resolved_profiles_;
 
     friend class TUVX;
   };
@@ -103,6 +119,14 @@ namespace musica
     /// @return a profile pointer, or nullptr if the profile is not found
     Profile *GetProfile(ProfileMap *profile_map, const char *profile_name, const char *profile_units, Error *error);
 
+    /// @brief Returns a profile that is resolved once and cached by the profile map
+    /// @param profile_map The profile map to resolve the profile from
+    /// @param profile_name The name of the profile we want
+    /// @param profile_units The units of the profile we want
+    /// @param error The error struct to indicate success or failure
+    /// @return a profile pointer owned by the map, or nullptr if the profile is not found
+    Profile *ResolveProfile(ProfileMap *profile_map, const char *profile_name, const char *profile_units, Error *error);
+
     /// @brief Returns a profile by index in the map
     /// @param profile_map The profile map to get the profile from
     /// @param index The index of the profile we want
@@ -123,6 +123,7 @@ namespace musica
     void *updater_;
 
     friend class RadiatorMap;
+    friend class TUVX;
 
     /// @brief Wraps an existing radiator instance. Used by RadiatorMap
     /// @param updater The updater for the radiator
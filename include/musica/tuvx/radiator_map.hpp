@@ -5,6 +5,7 @@
 #include <musica/tuvx/radiator.hpp>
 #include <musica/utils/util.hpp>
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -40,6 +41,18 @@ namespace musica
     /// @return Radiator
     Radiator *GetRadiator(const char *radiator_name, Error *error);
 
+    /// @brief Returns a radiator that is resolved once and cached by the map
+    ///
+    /// Repeated calls with the same key return the same wrapper without calling into TUV-x. The
+    /// wrapper is owned by the map and must not be deleted. Its data pointers (e.g.
+    /// Radiator::GetOpticalDepthsPointer) stay valid for the life of the radiator, so hosts can resolve them once
+    /// and update values in place every step. Resolved radiators are released when the map is
+    /// destroyed or when any radiator is removed from it.
+    /// @param radiator_name Radiator name
+    /// @param error The error struct to indicate success or failure
+    /// @return a radiator pointer owned by the map
+    Radiator *ResolveRadiator(const char *radiator_name, Error *error);
+
     /// @brief Returns a radiator based on its index in the map
     /// @param index Index of the radiator we want
     /// @param error Error to indicate success or failure
@@ -64,6 +77,7 @@ namespace musica
    private:
     void *radiator_map_;
     bool owns_radiator_map_;
+    std::map<std::string, std::unique_ptr<Radiator>> resolved_radiators_;
 
     friend class TUVX;
   };
@@ -99,6 +113,13 @@ namespace musica
     /// @return The radiator pointer, or nullptr if the radiator is not found
     Radiator *GetRadiator(RadiatorMap *radiator_map, const char *radiator_name, Error *error);
 
+    /// @brief Returns a radiator that is resolved once and cached by the radiator map
+    /// @param radiator_map The radiator map to resolve the radiator from
+    /// @param radiator_name Radiator name
+    /// @param error The error struct to indicate success or failure
+    /// @return a radiator pointer owned by the map, or nullptr if the radiator is not found
+    Radiator *ResolveRadiator(RadiatorMap *radiator_map, const char *radiator_name, Error *error);
+
     /// @brief Returns a radiator from the radiator map by index
     /// @param radiator_map Radiator map to get the radiator from
     /// @param index Index of the radiator we want
@@ -10,6 +10,7 @@
 #include <musica/tuvx/radiator_map.hpp>
 #include <musica/utils/util.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
@@ -17,6 +18,44 @@
 namespace musica
 {
 
+  // Flags selecting the outputs of a TUV-x run; combine with bitwise OR
+  enum TuvxOutput : unsigned int
+  {
+    PHOTOLYSIS_RATE_CONSTANTS = 1 << 0,
+    HEATING_RATES = 1 << 1,
+    DOSE_RATES = 1 << 2,
+    ACTINIC_FLUX = 1 << 3,
+    SPECTRAL_IRRADIANCE = 1 << 4,
+    ALL_OUTPUTS = PHOTOLYSIS_RATE_CONSTANTS | HEATING_RATES | DOSE_RATES | ACTINIC_FLUX | SPECTRAL_IRRADIANCE
+  };
+
+  struct InternalProfileUpdate;
+  struct InternalRadiatorUpdate;
+
+  /// @brief Host-supplied values of one profile for a batch of columns
+  ///
+  /// Each non-null array holds the values for every column back-to-back ([column][value]).
+  /// Profiles are resolved once (e.g. with ProfileMap::GetProfile) and reused for every column.
+  struct ColumnProfile
+  {
+    Profile *profile;
+    const double *edge_values;      // [column][edge] or nullptr to leave unchanged
+    const double *midpoint_values;  // [column][midpoint] or nullptr to leave unchanged
+    const double *layer_densities;  // [column][midpoint] or nullptr to leave unchanged
+  };
+
+  /// @brief Host-supplied optical properties of one radiator for a batch of columns
+  ///
+  /// Each non-null array holds the values for every column back-to-back, with each column in the
+  /// same layout as the corresponding Radiator setter (e.g. Radiator::SetOpticalDepths).
+  struct ColumnRadiator
+  {
+    Radiator *radiator;
+    const double *optical_depths;             // [column][wavelength][layer] or nullptr to leave unchanged
+    const double *single_scattering_albedos;  // [column][wavelength][layer] or nullptr to leave unchanged
+    const double *asymmetry_factors;          // [column][stream][wavelength][layer] or nullptr to leave unchanged
+  };
+
   class TUVX
   {
    public:
@@ -46,6 +85,22 @@ namespace musica
         RadiatorMap *radiators,
         Error *error);
 
+    /// @brief Set reduced wavelength bins that the host wavelength grid is mapped onto at creation
+    ///
+    /// Takes effect in the next call to Create or CreateFromConfigString, and requires the host to
+    /// supply the ("wavelength", "nm") grid. Each bin edge is moved to the nearest host grid edge, and
+    /// wavelengths outside the first and last bin edges are dropped; bin midpoints are halfway between
+    /// the bin edges. The host extraterrestrial flux is summed into the bins. The host surface albedo
+    /// and host radiators are averaged over each bin weighted by the host extraterrestrial flux (or by
+    /// the section widths where the host does not supply one). Other host profiles on the wavelength
+    /// grid cannot be binned, and creation fails if one is supplied. Profiles and radiators updated
+    /// after creation must be given on the reduced bins.
+    ///
+    /// Only the host-supplied data is binned. TUV-x still evaluates cross sections and quantum yields
+    /// with its own regridding onto the coarse grid (at the bin midpoints), without flux weighting.
+    /// @param bin_edges Strictly increasing wavelength bin edges [nm], or empty to use the host grid as is
+    void SetWavelengthBins(const std::vector<double> &bin_edges);
+
     /// @brief Returns a copy of the internal grid map. For now, this calls the internal tuvx fortran api, but will allow the
     /// change to c++ later on to be transparent to downstream projects
     /// @param error The error struct to indicate success or failure
@@ -80,6 +135,11 @@ namespace musica
     void GetDoseRatesOrdering(Mappings *mappings, Error *error);
 
     /// @brief Run the TUV-x photolysis calculator
+    ///
+    /// Any output pointer may be null, in which case that output is neither calculated nor copied.
+    /// Photolysis-only callers should pass null for the dose rates and radiation field outputs.
+    /// When the solar zenith angle is at or beyond the night threshold the column is dark at every
+    /// level, and the outputs are filled with zeros without running the radiative transfer solver.
     /// @param solar_zenith_angle Solar zenith angle [radians]
     /// @param earth_sun_distance Earth-Sun distance [AU]
     /// @param photolysis_rate_constants Photolysis rate constant [s^-1] (reaction, vertical edge)
@@ -99,6 +159,125 @@ namespace musica
         double *const spectral_irradiance,
         Error *const error);
 
+    /// @brief Run the TUV-x photolysis calculator for several columns, one after another
+    ///
+    /// Profiles and radiators are updated in place from the per-column arrays, in a single call into
+    /// TUV-x, before each column is solved.
+    /// Outputs for each column are written back-to-back using the same per-column layout as Run,
+    /// so, for example, photolysis rate constants are (column, reaction, vertical edge). As with Run,
+    /// any output pointer may be null to skip that output. Columns that are dark (see
+    /// SetNightThreshold) are zero-filled without updating their profiles. The columns share the
+    /// radiative transfer state of this instance and are solved one after another on the calling
+    /// thread. This only saves per-call overhead; it is not faster than calling Run per column
+    /// beyond that, and does not run columns in parallel. It has not been established that the
+    /// TUV-x Fortran core is reentrant, so TUVX instances (this one or others) must not be run
+    /// concurrently from several threads.
+    /// @param number_of_columns Number of columns
+    /// @param solar_zenith_angles Solar zenith angle for each column [radians]
+    /// @param earth_sun_distances Earth-Sun distance for each column [AU]
+    /// @param column_profiles Profiles to update for each column
+    /// @param column_radiators Radiators to update for each column
+    /// @param photolysis_rate_constants Photolysis rate constants [s^-1] (column, reaction, vertical edge)
+    /// @param heating_rates Heating rates [K/s] (column, heating_reaction, vertical edge)
+    /// @param dose_rates Dose rates [W/m^2] (column, dose_rate type, vertical edge)
+    /// @param actinic_flux Actinic flux [photons cm^-2 s^-1 nm^-1] (column, wavelength, vertical edge,
+    /// direct/upwelling/downwelling)
+    /// @param spectral_irradiance Spectral irradiance [W/m^2 nm^-1] (column, wavelength, vertical edge,
+    /// direct/upwelling/downwelling)
+    /// @param error Error struct to indicate success or failure
+    void RunColumns(
+        const std::size_t number_of_columns,
+        const double *const solar_zenith_angles,
+        const double *const earth_sun_distances,
+        const std::vector<ColumnProfile> &column_profiles,
+        const std::vector<ColumnRadiator> &column_radiators,
+        double *const photolysis_rate_constants,
+        double *const heating_rates,
+        double *const dose_rates,
+        double *const actinic_flux,
+        double *const spectral_irradiance,
+        Error *const error);
+
+    /// @brief Update a set of profiles and radiators from one column of packed host data
+    ///
+    /// All values are applied in a single call into TUV-x, rather than one call per array.
+    /// @param column Index of the column to apply from the packed arrays
+    /// @param column_profiles Profiles to update
+    /// @param column_radiators Radiators to update
+    /// @param error Error struct to indicate success or failure
+    void UpdateColumn(
+        const std::size_t column,
+        const std::vector<ColumnProfile> &column_profiles,
+        const std::vector<ColumnRadiator> &column_radiators,
+        Error *const error);
+
+    /// @brief Set the solar zenith angle at and beyond which the whole column is treated as dark
+    /// @param night_threshold Solar zenith angle [radians]. A negative value restores the default,
+    /// which is the angle at which the sun sets at the top of the height grid. The default is
+    /// calculated from the height grid edges the first time it is needed and reused afterwards.
+    void SetNightThreshold(const double night_threshold);
+
+    /// @brief Get the solar zenith angle at and beyond which the whole column is treated as dark
+    /// @param error Error struct to indicate success or failure
+    /// @return Night threshold solar zenith angle [radians]
+    double GetNightThreshold(Error *const error);
+
+    /// @brief Tabulate photolysis rate constants on a grid of solar zenith angles
+    ///
+    /// The table is calculated from the current state of the profiles and radiators, so it should
+    /// be rebuilt when they change appreciably. Once created, RunFromLookupTable answers
+    /// photolysis requests by interpolation instead of solving the radiative transfer.
+    /// @param solar_zenith_angles Strictly increasing solar zenith angles to tabulate [radians]
+    /// @param error Error struct to indicate success or failure
+    void CreatePhotolysisLookupTable(const std::vector<double> &solar_zenith_angles, Error *const error);
+
+    /// @brief Tabulate photolysis rate constants on a grid of solar zenith angle and overhead ozone column
+    ///
+    /// For each tabulated ozone column the ozone profile is scaled by the ratio of that column to its
+    /// current total column (layer densities including the exo layer density). The ozone profile is
+    /// restored to its original values once the table is built.
+    /// @param solar_zenith_angles Strictly increasing solar zenith angles to tabulate [radians]
+    /// @param ozone Ozone profile to scale (e.g. from ProfileMap::GetProfile)
+    /// @param ozone_columns Strictly increasing overhead ozone columns to tabulate [units of the ozone layer densities]
+    /// @param error Error struct to indicate success or failure
+    void CreatePhotolysisLookupTable(
+        const std::vector<double> &solar_zenith_angles,
+        Profile *ozone,
+        const std::vector<double> &ozone_columns,
+        Error *const error);
+
+    /// @brief Returns whether a photolysis lookup table has been created
+    bool HasPhotolysisLookupTable() const;
+
+    /// @brief Interpolate photolysis rate constants from the lookup table
+    ///
+    /// Solar zenith angles outside the tabulated range are clamped to the nearest tabulated angle.
+    /// @param solar_zenith_angle Solar zenith angle [radians]
+    /// @param earth_sun_distance Earth-Sun distance [AU]
+    /// @param photolysis_rate_constants Photolysis rate constant [s^-1] (reaction, vertical edge)
+    /// @param error Error struct to indicate success or failure
+    void RunFromLookupTable(
+        const double solar_zenith_angle,
+        const double earth_sun_distance,
+        double *const photolysis_rate_constants,
+        Error *const error);
+
+    /// @brief Interpolate photolysis rate constants from a lookup table with an ozone column dimension
+    ///
+    /// Solar zenith angles and ozone columns outside the tabulated ranges are clamped to the nearest
+    /// tabulated values.
+    /// @param solar_zenith_angle Solar zenith angle [radians]
+    /// @param earth_sun_distance Earth-Sun distance [AU]
+    /// @param ozone_column Overhead ozone column [units of the tabulated ozone columns]
+    /// @param photolysis_rate_constants Photolysis rate constant [s^-1] (reaction, vertical edge)
+    /// @param error Error struct to indicate success or failure
+    void RunFromLookupTable(
+        const double solar_zenith_angle,
+        const double earth_sun_distance,
+        const double ozone_column,
+        double *const photolysis_rate_constants,
+        Error *const error);
+
     /// @brief Get the version of TUV-x
     /// @return TUV-x version string
     static std::string GetVersion();
@@ -132,6 +311,45 @@ namespace musica
     void *tuvx_;
     int number_of_height_midpoints_;
     int number_of_wavelength_midpoints_;
+    double night_threshold_;          // [radians], negative to use the sunset angle at the top of the height grid
+    double default_night_threshold_;  // [radians], sunset angle at the top of the height grid, negative until first used
+    std::vector<double> wavelength_bin_edges_;  // [nm], empty to use the host wavelength grid as is
+
+    /// @brief Creates copies of the host data with the host wavelength grid mapped onto the wavelength bins
+    /// @throws std::runtime_error if the host does not supply the wavelength grid or the bins do not fit it
+    void BinHostWavelengths(
+        GridMap *grids,
+        ProfileMap *profiles,
+        RadiatorMap *radiators,
+        std::unique_ptr<GridMap> &binned_grids,
+        std::unique_ptr<ProfileMap> &binned_profiles,
+        std::unique_ptr<RadiatorMap> &binned_radiators);
+
+    /// @brief Collects the TUV-x updaters and data pointers of a set of column profiles and radiators
+    /// @return false (with error set) if any profile or radiator is not set
+    bool PackColumnUpdates(
+        const std::vector<ColumnProfile> &column_profiles,
+        const std::vector<ColumnRadiator> &column_radiators,
+        std::vector<InternalProfileUpdate> &profile_updates,
+        std::vector<InternalRadiatorUpdate> &radiator_updates,
+        Error *const error);
+
+    /// @brief Returns whether every level of the column is dark at a given solar zenith angle
+    bool IsDark(const double solar_zenith_angle, Error *const error);
+
+    /// @brief Fills the requested outputs of a dark column with zeros
+    /// @throws std::runtime_error if the output sizes cannot be determined
+    void FillDarkColumn(
+        double *const photolysis_rate_constants,
+        double *const heating_rates,
+        double *const dose_rates,
+        double *const actinic_flux,
+        double *const spectral_irradiance);
+
+    // Photolysis lookup table, tabulated at 1 AU (ozone column, solar zenith angle, reaction, vertical edge)
+    std::vector<double> lookup_solar_zenith_angles_;
+    std::vector<double> lookup_ozone_columns_;
+    std::vector<double> lookup_photolysis_rate_constants_;
   };
 
 }  // namespace musica
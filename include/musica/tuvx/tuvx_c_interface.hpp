@@ -98,6 +98,63 @@ namespace musica
         double* const spectral_irradiance,
         Error* const error);
 
+    /// @brief Run the TUV-x photolysis calculator for several columns, one after another
+    ///        (see TUVX::RunColumns; columns are not run in parallel)
+    /// @param tuvx Pointer to TUVX instance
+    /// @param number_of_columns Number of columns
+    /// @param solar_zenith_angles Solar zenith angle for each column [radians]
+    /// @param earth_sun_distances Earth-Sun distance for each column [AU]
+    /// @param column_profiles Profiles to update for each column
+    /// @param number_of_column_profiles Number of entries in column_profiles
+    /// @param column_radiators Radiators to update for each column
+    /// @param number_of_column_radiators Number of entries in column_radiators
+    /// @param photolysis_rate_constants Photolysis rate constants [s^-1] (column, reaction, vertical edge)
+    /// @param heating_rates Heating rates [K/s] (column, heating_reaction, vertical edge)
+    /// @param dose_rates Dose rates [W/m^2] (column, dose_rate type, vertical edge)
+    /// @param actinic_flux Actinic flux [photons cm^-2 s^-1 nm^-1] (column, wavelength, vertical edge,
+    /// direct/upwelling/downwelling)
+    /// @param spectral_irradiance Spectral irradiance [W m^-2 nm^-1] (column, wavelength, vertical edge,
+    /// direct/upwelling/downwelling)
+    /// @param error Error struct to indicate success or failure
+    void RunTuvxColumns(
+        TUVX* tuvx,
+        const std::size_t number_of_columns,
+        const double* const solar_zenith_angles,
+        const double* const earth_sun_distances,
+        const ColumnProfile* const column_profiles,
+        const std::size_t number_of_column_profiles,
+        const ColumnRadiator* const column_radiators,
+        const std::size_t number_of_column_radiators,
+        double* const photolysis_rate_constants,
+        double* const heating_rates,
+        double* const dose_rates,
+        double* const actinic_flux,
+        double* const spectral_irradiance,
+        Error* const error);
+
+    /// @brief Updates a set of profiles and radiators from one column of packed host data in a single call
+    /// @param tuvx Pointer to TUVX instance
+    /// @param column Index of the column to apply from the packed arrays
+    /// @param column_profiles Profiles to update
+    /// @param number_of_column_profiles Number of entries in column_profiles
+    /// @param column_radiators Radiators to update
+    /// @param number_of_column_radiators Number of entries in column_radiators
+    /// @param error Error struct to indicate success or failure
+    void UpdateTuvxColumn(
+        TUVX* tuvx,
+        const std::size_t column,
+        const ColumnProfile* const column_profiles,
+        const std::size_t number_of_column_profiles,
+        const ColumnRadiator* const column_radiators,
+        const std::size_t number_of_column_radiators,
+        Error* const error);
+
+    /// @brief Sets the solar zenith angle at and beyond which the whole column is treated as dark
+    /// @param tuvx Pointer to TUVX instance
+    /// @param night_threshold Solar zenith angle [radians]; negative to use the sunset angle at the top of the height grid
+    /// @param error Error struct to indicate success or failure
+    void SetTuvxNightThreshold(TUVX* tuvx, const double night_threshold, Error* error);
+
     /// @brief Get the TUVX version
     /// @param tuvx_version TUVX version [output]
     void TuvxVersion(String* tuvx_version);
@@ -143,6 +200,32 @@ namespace musica
         double* spectral_irradiance,
         int* error_code);
 
+    /// @brief Host-supplied profile values passed to TUV-x in a bulk column update
+    struct InternalProfileUpdate
+    {
+      void* updater;
+      const double* edge_values;
+      const double* midpoint_values;
+      const double* layer_densities;
+    };
+
+    /// @brief Host-supplied radiator optical properties passed to TUV-x in a bulk column update
+    struct InternalRadiatorUpdate
+    {
+      void* updater;
+      const double* optical_depths;
+      const double* single_scattering_albedos;
+      const double* asymmetry_factors;
+    };
+
+    void InternalUpdateColumn(
+        const InternalProfileUpdate* profile_updates,
+        const std::size_t number_of_profiles,
+        const InternalRadiatorUpdate* radiator_updates,
+        const std::size_t number_of_radiators,
+        const std::size_t column,
+        int* error_code);
+
     void InternalGetTuvxVersion(char** version_ptr, int* version_length);
     void InternalFreeTuvxVersion(char* version_ptr, int version_length);
     int InternalGetPhotolysisRateConstantCount(void* tuvx, int* error_code);
@@ -1,13 +1,17 @@
 #include "../common.hpp"
 
 #include <musica/carma/carma.hpp>
+#include <musica/carma/carma_column_batch.hpp>
 #include <musica/carma/carma_state.hpp>
 
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
 #include <iostream>
+#include <string>
+#include <vector>
 
 namespace py = pybind11;
 
@@ -103,6 +107,123 @@ auto to_surface_properties = [](const py::object& obj) -> musica::CARMASurfacePr
   throw std::invalid_argument("Expected a dictionary for surface properties");
 };
 
+auto to_state_parameters = [](const py::dict& kwargs) -> musica::CARMAStateParameters
+{
+  musica::CARMAStateParameters params;
+  params.time = kwargs.contains("time") ? kwargs["time"].cast<double>() : 0.0;
+  params.time_step = kwargs.contains("time_step") ? kwargs["time_step"].cast<double>() : 0.0;
+  params.longitude = kwargs.contains("longitude") ? kwargs["longitude"].cast<double>() : 0.0;
+  params.latitude = kwargs.contains("latitude") ? kwargs["latitude"].cast<double>() : 0.0;
+  params.coordinates = kwargs.contains("coordinates")
+                           ? static_cast<musica::CarmaCoordinates>(kwargs["coordinates"].cast<int>())
+                           : musica::CarmaCoordinates::CARTESIAN;
+  params.vertical_center = to_vector_double(kwargs["vertical_center"]);
+  params.vertical_levels = to_vector_double(kwargs["vertical_levels"]);
+  params.temperature = to_vector_double(kwargs["temperature"]);
+  params.original_temperature = to_vector_double(kwargs["original_temperature"]);
+  params.pressure = to_vector_double(kwargs["pressure"]);
+  params.pressure_levels = to_vector_double(kwargs["pressure_levels"]);
+  if (kwargs.contains("relative_humidity") && !kwargs["relative_humidity"].is_none())
+  {
+    params.relative_humidity = to_vector_double(kwargs["relative_humidity"]);
+  }
+  if (kwargs.contains("specific_humidity") && !kwargs["specific_humidity"].is_none())
+  {
+    params.specific_humidity = to_vector_double(kwargs["specific_humidity"]);
+  }
+  if (kwargs.contains("radiative_intensity") && !kwargs["radiative_intensity"].is_none())
+  {
+    auto array_2d = array_2d_to_vector_double(kwargs["radiative_intensity"]);
+    params.radiative_intensity = std::get<0>(array_2d);
+    params.radiative_intensity_dim_1_size = std::get<1>(array_2d);
+    params.radiative_intensity_dim_2_size = std::get<2>(array_2d);
+  }
+  return params;
+};
+
+auto to_step_config = [](const py::dict& kwargs) -> musica::CARMAStateStepConfig
+{
+  musica::CARMAStateStepConfig step_config;
+
+  if (kwargs.contains("cloud_fraction"))
+    step_config.cloud_fraction = to_vector_double(kwargs["cloud_fraction"]);
+  if (kwargs.contains("critical_relative_humidity"))
+    step_config.critical_relative_humidity = to_vector_double(kwargs["critical_relative_humidity"]);
+  if (kwargs.contains("land"))
+    step_config.land = to_surface_properties(kwargs["land"]);
+  if (kwargs.contains("ocean"))
+    step_config.ocean = to_surface_properties(kwargs["ocean"]);
+  if (kwargs.contains("ice"))
+    step_config.ice = to_surface_properties(kwargs["ice"]);
+  return step_config;
+};
+
+auto to_statistics_dict = [](const musica::CarmaStatistics& stats) -> py::dict
+{
+  py::dict result;
+  result["max_number_of_substeps"] = stats.max_number_of_substeps;
+  result["max_number_of_retries"] = stats.max_number_of_retries;
+  result["total_number_of_steps"] = stats.total_number_of_steps;
+  result["total_number_of_substeps"] = stats.total_number_of_substeps;
+  result["total_number_of_retries"] = stats.total_number_of_retries;
+  // check if stats.z_substeps is all -1s, if so, set the result to None
+  if (std::all_of(stats.z_substeps.begin(), stats.z_substeps.end(), [](int val) { return val == -1; }))
+  {
+    result["z_substeps"] = py::none();
+  }
+  else
+  {
+    result["z_substeps"] = stats.z_substeps;
+  }
+  result["xc"] = stats.xc;
+  result["yc"] = stats.yc;
+  py::dict timing;
+  timing["enabled"] = stats.timing.enabled;
+  timing["number_of_steps"] = stats.timing.number_of_steps;
+  timing["step_time"] = stats.timing.step_time;
+  timing["max_step_time"] = stats.timing.max_step_time;
+  timing["set_time"] = stats.timing.set_time;
+  timing["get_time"] = stats.timing.get_time;
+  result["timing"] = timing;
+  return result;
+};
+
+auto shape_to_string = [](const std::vector<py::ssize_t>& shape) -> std::string
+{
+  std::string result;
+  for (const auto dimension : shape)
+    result += (result.empty() ? "" : ", ") + std::to_string(dimension);
+  return "(" + result + ")";
+};
+
+// Bulk outputs are written in place, so buffers must already have the exact shape and layout CARMA
+// writes. Nothing is converted or copied, as a silent copy would be lost.
+auto to_output_buffer = [](const py::object& values, const char* name, const std::vector<py::ssize_t>& shape) -> double*
+{
+  if (!py::isinstance<py::array>(values))
+    throw py::type_error(std::string("Output buffer '") + name + "' must be a NumPy array");
+  auto array = values.cast<py::array>();
+  if (!array.dtype().is(py::dtype::of<double>()))
+    throw py::type_error(std::string("Output buffer '") + name + "' must have dtype float64");
+  if (!(array.flags() & py::array::c_style) || !array.writeable())
+    throw py::value_error(std::string("Output buffer '") + name + "' must be writeable and C-contiguous");
+  if (array.ndim() != static_cast<py::ssize_t>(shape.size()) || !std::equal(shape.begin(), shape.end(), array.shape()))
+    throw py::value_error(std::string("Output buffer '") + name + "' must have shape " + shape_to_string(shape));
+  return static_cast<double*>(array.mutable_data());
+};
+
+// Bulk inputs are viewed directly when they are C-contiguous float64 arrays and converted otherwise
+auto to_input_array = [](const py::object& values, const char* name, const std::vector<py::ssize_t>& shape)
+    -> py::array_t<double, py::array::c_style | py::array::forcecast>
+{
+  auto array = py::array_t<double, py::array::c_style | py::array::forcecast>::ensure(values);
+  if (!array)
+    throw py::type_error(std::string("Input '") + name + "' must be convertible to a float64 array");
+  if (array.ndim() != static_cast<py::ssize_t>(shape.size()) || !std::equal(shape.begin(), shape.end(), array.shape()))
+    throw py::value_error(std::string("Input '") + name + "' must have shape " + shape_to_string(shape));
+  return array;
+};
+
 void bind_carma(py::module_& carma)
 {
   carma.def("_get_carma_version", []() { return musica::CARMA::GetVersion(); }, "Get the version of the CARMA instance");
@@ -664,37 +785,7 @@ void bind_carma(py::module_& carma)
       "_create_carma_state",
       [](std::uintptr_t carma_ptr, py::kwargs kwargs)
       {
-        // Helper lambdas for robust flexible casting
-        musica::CARMAStateParameters params;
-        params.time = kwargs.contains("time") ? kwargs["time"].cast<double>() : 0.0;
-        params.time_step = kwargs.contains("time_step") ? kwargs["time_step"].cast<double>() : 0.0;
-        params.longitude = kwargs.contains("longitude") ? kwargs["longitude"].cast<double>() : 0.0;
-        params.latitude = kwargs.contains("latitude") ? kwargs["latitude"].cast<double>() : 0.0;
-        params.coordinates = kwargs.contains("coordinates")
-                                 ? static_cast<musica::CarmaCoordinates>(kwargs["coordinates"].cast<int>())
-                                 : musica::CarmaCoordinates::CARTESIAN;
-        params.vertical_center = to_vector_double(kwargs["vertical_center"]);
-        params.vertical_levels = to_vector_double(kwargs["vertical_levels"]);
-        params.temperature = to_vector_double(kwargs["temperature"]);
-        params.original_temperature = to_vector_double(kwargs["original_temperature"]);
-        params.pressure = to_vector_double(kwargs["pressure"]);
-        params.pressure_levels = to_vector_double(kwargs["pressure_levels"]);
-        if (kwargs.contains("relative_humidity") && !kwargs["relative_humidity"].is_none())
-        {
-          params.relative_humidity = to_vector_double(kwargs["relative_humidity"]);
-        }
-        if (kwargs.contains("specific_humidity") && !kwargs["specific_humidity"].is_none())
-        {
-          params.specific_humidity = to_vector_double(kwargs["specific_humidity"]);
-        }
-        if (kwargs.contains("radiative_intensity") && !kwargs["radiative_intensity"].is_none())
-        {
-          auto array_2d = array_2d_to_vector_double(kwargs["radiative_intensity"]);
-          params.radiative_intensity = std::get<0>(array_2d);
-          params.radiative_intensity_dim_1_size = std::get<1>(array_2d);
-          params.radiative_intensity_dim_2_size = std::get<2>(array_2d);
-        }
-
+        musica::CARMAStateParameters params = to_state_parameters(kwargs);
         musica::CARMA* carma_instance = reinterpret_cast<musica::CARMA*>(carma_ptr);
         try
         {
@@ -709,6 +800,24 @@ void bind_carma(py::module_& carma)
       py::arg("carma_pointer"),
       "Create a CARMA state for a specific column with named arguments");
 
+  carma.def(
+      "_reset_carma_state",
+      [](std::uintptr_t carma_state_ptr, py::kwargs kwargs)
+      {
+        musica::CARMAStateParameters params = to_state_parameters(kwargs);
+        auto carma_state = reinterpret_cast<musica::CARMAState*>(carma_state_ptr);
+        try
+        {
+          carma_state->Reset(params);
+        }
+        catch (const std::exception& e)
+        {
+          throw py::value_error("Error resetting CARMA state: " + std::string(e.what()));
+        }
+      },
+      py::arg("carma_state_pointer"),
+      "Load a new column into an existing CARMA state with named arguments");
+
   carma.def(
       "_delete_carma_state",
       [](std::uintptr_t carma_state_ptr)
@@ -760,28 +869,28 @@ void bind_carma(py::module_& carma)
       [](std::uintptr_t carma_state_ptr)
       {
         auto carma_state = reinterpret_cast<musica::CARMAState*>(carma_state_ptr);
-        musica::CarmaStatistics stats = carma_state->GetStepStatistics();
-        py::dict result;
-        result["max_number_of_substeps"] = stats.max_number_of_substeps;
-        result["max_number_of_retries"] = stats.max_number_of_retries;
-        result["total_number_of_steps"] = stats.total_number_of_steps;
-        result["total_number_of_substeps"] = stats.total_number_of_substeps;
-        result["total_number_of_retries"] = stats.total_number_of_retries;
-        // check if stats.z_substeps is all -1s, if so, set the result to None
-        if (std::all_of(stats.z_substeps.begin(), stats.z_substeps.end(), [](int val) { return val == -1; }))
-        {
-          result["z_substeps"] = py::none();
-        }
-        else
-        {
-          result["z_substeps"] = stats.z_substeps;
-        }
-        result["xc"] = stats.xc;
-        result["yc"] = stats.yc;
-        return result;
+        return to_statistics_dict(carma_state->GetStepStatistics());
       },
       "Get the step statistics for the current CARMAState");
 
+  carma.def(
+      "_enable_timing",
+      [](std::uintptr_t carma_state_ptr, bool enabled)
+      {
+        auto carma_state = reinterpret_cast<musica::CARMAState*>(carma_state_ptr);
+        carma_state->EnableTiming(enabled);
+      },
+      "Enable or disable collection of timers and counters for the CARMAState");
+
+  carma.def(
+      "_reset_timing",
+      [](std::uintptr_t carma_state_ptr)
+      {
+        auto carma_state = reinterpret_cast<musica::CARMAState*>(carma_state_ptr);
+        carma_state->ResetTiming();
+      },
+      "Reset the timers and counters of the CARMAState");
+
   carma.def(
       "_get_bin",
       [](std::uintptr_t carma_state_ptr, int bin_index, int element_index)
@@ -885,18 +994,7 @@ void bind_carma(py::module_& carma)
       [](std::uintptr_t carma_state_ptr, py::kwargs kwargs)
       {
         auto carma_state = reinterpret_cast<musica::CARMAState*>(carma_state_ptr);
-        musica::CARMAStateStepConfig step_config;
-
-        if (kwargs.contains("cloud_fraction"))
-          step_config.cloud_fraction = to_vector_double(kwargs["cloud_fraction"]);
-        if (kwargs.contains("critical_relative_humidity"))
-          step_config.critical_relative_humidity = to_vector_double(kwargs["critical_relative_humidity"]);
-        if (kwargs.contains("land"))
-          step_config.land = to_surface_properties(kwargs["land"]);
-        if (kwargs.contains("ocean"))
-          step_config.ocean = to_surface_properties(kwargs["ocean"]);
-        if (kwargs.contains("ice"))
-          step_config.ice = to_surface_properties(kwargs["ice"]);
+        musica::CARMAStateStepConfig step_config = to_step_config(kwargs);
 
         try
         {
@@ -908,4 +1006,202 @@ void bind_carma(py::module_& carma)
         }
       },
       "Step the CARMA state with specified parameters");
-}
\ No newline at end of file
+
+  carma.def(
+      "_get_bins_into",
+      [](std::uintptr_t carma_state_ptr, py::object profiles, py::object fall_velocity, py::object surface_values)
+      {
+        auto carma_state = reinterpret_cast<musica::CARMAState*>(carma_state_ptr);
+        py::ssize_t const nz = carma_state->GetNumberOfVerticalCenters();
+        py::ssize_t const nbin = carma_state->GetNumberOfBins();
+        py::ssize_t const nelem = carma_state->GetNumberOfElements();
+        py::ssize_t const n_profile_fields = static_cast<py::ssize_t>(musica::CarmaBinProfileField::NUMBER_OF_FIELDS);
+        py::ssize_t const n_surface_fields = static_cast<py::ssize_t>(musica::CarmaBinSurfaceField::NUMBER_OF_FIELDS);
+        double* profiles_data = to_output_buffer(profiles, "profiles", { n_profile_fields, nelem, nbin, nz });
+        double* fall_velocity_data = to_output_buffer(fall_velocity, "fall_velocity", { nelem, nbin, nz + 1 });
+        double* surface_data = to_output_buffer(surface_values, "surface_values", { n_surface_fields, nelem, nbin });
+        carma_state->GetBins(profiles_data, fall_velocity_data, surface_data);
+      },
+      py::arg("carma_state_pointer"),
+      py::arg("profiles"),
+      py::arg("fall_velocity"),
+      py::arg("surface_values"),
+      "Fill NumPy arrays with the values of every bin and element in the CARMA state");
+
+  carma.def(
+      "_set_bins_from_array",
+      [](std::uintptr_t carma_state_ptr, py::object values, py::object surface_mass)
+      {
+        auto carma_state = reinterpret_cast<musica::CARMAState*>(carma_state_ptr);
+        py::ssize_t const nz = carma_state->GetNumberOfVerticalCenters();
+        py::ssize_t const nbin = carma_state->GetNumberOfBins();
+        py::ssize_t const nelem = carma_state->GetNumberOfElements();
+        auto values_array = to_input_array(values, "mass_mixing_ratio", { nelem, nbin, nz });
+        auto surface_array = surface_mass.is_none()
+                                 ? py::array_t<double, py::array::c_style | py::array::forcecast>({ nelem, nbin })
+                                 : to_input_array(surface_mass, "surface_mass", { nelem, nbin });
+        if (surface_mass.is_none())
+          std::fill_n(surface_array.mutable_data(), surface_array.size(), 0.0);
+        carma_state->SetBins(values_array.data(), surface_array.data());
+      },
+      py::arg("carma_state_pointer"),
+      py::arg("mass_mixing_ratio"),
+      py::arg("surface_mass") = py::none(),
+      "Set the mass mixing ratios of every bin and element from an (element, bin, vertical center) array");
+
+  carma.def(
+      "_get_gases_into",
+      [](std::uintptr_t carma_state_ptr, py::object values)
+      {
+        auto carma_state = reinterpret_cast<musica::CARMAState*>(carma_state_ptr);
+        py::ssize_t const nz = carma_state->GetNumberOfVerticalCenters();
+        py::ssize_t const ngas = carma_state->GetNumberOfGases();
+        py::ssize_t const n_fields = static_cast<py::ssize_t>(musica::CarmaGasField::NUMBER_OF_FIELDS);
+        carma_state->GetGases(to_output_buffer(values, "values", { n_fields, ngas, nz }));
+      },
+      py::arg("carma_state_pointer"),
+      py::arg("values"),
+      "Fill a NumPy array with the values of every gas in the CARMA state");
+
+  carma.def(
+      "_set_gases_from_array",
+      [](std::uintptr_t carma_state_ptr,
+         py::object values,
+         py::object old_mmr,
+         py::object gas_saturation_wrt_ice,
+         py::object gas_saturation_wrt_liquid)
+      {
+        auto carma_state = reinterpret_cast<musica::CARMAState*>(carma_state_ptr);
+        std::vector<py::ssize_t> const shape = { carma_state->GetNumberOfGases(),
+                                                 carma_state->GetNumberOfVerticalCenters() };
+        auto values_array = to_input_array(values, "mass_mixing_ratio", shape);
+        py::array_t<double, py::array::c_style | py::array::forcecast> old_mmr_array, ice_array, liquid_array;
+        if (!old_mmr.is_none())
+          old_mmr_array = to_input_array(old_mmr, "old_mmr", shape);
+        if (!gas_saturation_wrt_ice.is_none())
+          ice_array = to_input_array(gas_saturation_wrt_ice, "gas_saturation_wrt_ice", shape);
+        if (!gas_saturation_wrt_liquid.is_none())
+          liquid_array = to_input_array(gas_saturation_wrt_liquid, "gas_saturation_wrt_liquid", shape);
+        carma_state->SetGases(
+            values_array.data(),
+            old_mmr.is_none() ? nullptr : old_mmr_array.data(),
+            gas_saturation_wrt_ice.is_none() ? nullptr : ice_array.data(),
+            gas_saturation_wrt_liquid.is_none() ? nullptr : liquid_array.data());
+      },
+      py::arg("carma_state_pointer"),
+      py::arg("mass_mixing_ratio"),
+      py::arg("old_mmr") = py::none(),
+      py::arg("gas_saturation_wrt_ice") = py::none(),
+      py::arg("gas_saturation_wrt_liquid") = py::none(),
+      "Set the profiles of every gas from (gas, vertical center) arrays");
+
+  carma.def(
+      "_get_environmental_values_into",
+      [](std::uintptr_t carma_state_ptr, py::object values)
+      {
+        auto carma_state = reinterpret_cast<musica::CARMAState*>(carma_state_ptr);
+        py::ssize_t const nz = carma_state->GetNumberOfVerticalCenters();
+        py::ssize_t const n_fields = static_cast<py::ssize_t>(musica::CarmaEnvironmentalField::NUMBER_OF_FIELDS);
+        carma_state->GetEnvironmentalValues(to_output_buffer(values, "values", { n_fields, nz }));
+      },
+      py::arg("carma_state_pointer"),
+      py::arg("values"),
+      "Fill a NumPy array with the environmental values of the CARMA state");
+
+  carma.def(
+      "_create_carma_column_batch",
+      [](std::uintptr_t carma_ptr, py::list columns, std::size_t number_of_threads)
+      {
+        std::vector<musica::CARMAStateParameters> column_params;
+        column_params.reserve(columns.size());
+        for (const auto& column : columns)
+        {
+          column_params.push_back(to_state_parameters(column.cast<py::dict>()));
+        }
+        musica::CARMA* carma_instance = reinterpret_cast<musica::CARMA*>(carma_ptr);
+        try
+        {
+          auto batch = new musica::CARMAColumnBatch(*carma_instance, column_params, number_of_threads);
+          return reinterpret_cast<std::uintptr_t>(batch);
+        }
+        catch (const std::exception& e)
+        {
+          throw py::value_error("Error creating CARMA column batch: " + std::string(e.what()));
+        }
+      },
+      py::arg("carma_pointer"),
+      py::arg("columns"),
+      py::arg("number_of_threads") = 1,
+      "Create a batch of CARMA column states from a list of per-column state parameters");
+
+  carma.def(
+      "_delete_carma_column_batch",
+      [](std::uintptr_t batch_ptr)
+      {
+        auto batch = reinterpret_cast<musica::CARMAColumnBatch*>(batch_ptr);
+        delete batch;
+      },
+      "Delete a CARMA column batch instance");
+
+  carma.def(
+      "_get_carma_column_batch_column",
+      [](std::uintptr_t batch_ptr, std::size_t column_index)
+      {
+        auto batch = reinterpret_cast<musica::CARMAColumnBatch*>(batch_ptr);
+        try
+        {
+          return reinterpret_cast<std::uintptr_t>(&batch->GetColumn(column_index));
+        }
+        catch (const std::out_of_range& e)
+        {
+          throw py::index_error(e.what());
+        }
+      },
+      "Get a pointer to the CARMA state of one column in the batch (owned by the batch)");
+
+  carma.def(
+      "_get_carma_column_batch_number_of_threads",
+      [](std::uintptr_t batch_ptr)
+      {
+        auto batch = reinterpret_cast<musica::CARMAColumnBatch*>(batch_ptr);
+        return batch->NumberOfThreads();
+      },
+      "Get the number of worker threads used to step the columns of the batch");
+
+  carma.def(
+      "_step_carma_column_batch",
+      [](std::uintptr_t batch_ptr, py::list step_configs)
+      {
+        auto batch = reinterpret_cast<musica::CARMAColumnBatch*>(batch_ptr);
+        std::vector<musica::CARMAStateStepConfig> configs;
+        configs.reserve(step_configs.size());
+        for (const auto& step_config : step_configs)
+        {
+          configs.push_back(to_step_config(step_config.cast<py::dict>()));
+        }
+        try
+        {
+          py::gil_scoped_release release;
+          batch->Step(configs);
+        }
+        catch (const std::exception& e)
+        {
+          throw py::value_error("Error stepping CARMA column batch: " + std::string(e.what()));
+        }
+      },
+      "Step every column of the CARMA column batch concurrently, with one step configuration per column");
+
+  carma.def(
+      "_get_carma_column_batch_step_statistics",
+      [](std::uintptr_t batch_ptr)
+      {
+        auto batch = reinterpret_cast<musica::CARMAColumnBatch*>(batch_ptr);
+        py::list result;
+        for (const auto& stats : batch->GetStepStatistics())
+        {
+          result.append(to_statistics_dict(stats));
+        }
+        return result;
+      },
+      "Get the step statistics for each column of the CARMA column batch");
+}
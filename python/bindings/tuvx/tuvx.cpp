@@ -7,7 +7,10 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace py = pybind11;
 
@@ -63,9 +66,17 @@ void bind_tuvx(py::module_& tuvx)
       },
       "Delete a TUV-x instance");
 
+  py::enum_<musica::TuvxOutput>(tuvx, "_TuvxOutput", py::arithmetic())
+      .value("PHOTOLYSIS_RATE_CONSTANTS", musica::TuvxOutput::PHOTOLYSIS_RATE_CONSTANTS)
+      .value("HEATING_RATES", musica::TuvxOutput::HEATING_RATES)
+      .value("DOSE_RATES", musica::TuvxOutput::DOSE_RATES)
+      .value("ACTINIC_FLUX", musica::TuvxOutput::ACTINIC_FLUX)
+      .value("SPECTRAL_IRRADIANCE", musica::TuvxOutput::SPECTRAL_IRRADIANCE)
+      .value("ALL_OUTPUTS", musica::TuvxOutput::ALL_OUTPUTS);
+
   tuvx.def(
       "_run_tuvx",
-      [](std::uintptr_t tuvx_ptr, double sza_radians, double earth_sun_distance)
+      [](std::uintptr_t tuvx_ptr, double sza_radians, double earth_sun_distance, unsigned int outputs)
       {
         musica::TUVX* tuvx_instance = reinterpret_cast<musica::TUVX*>(tuvx_ptr);
 
@@ -76,75 +87,140 @@ void bind_tuvx(py::module_& tuvx)
         int n_layers = tuvx_instance->GetNumberOfHeightMidpoints();
         int n_wavelengths = tuvx_instance->GetNumberOfWavelengthMidpoints();
 
-        // Allocate output arrays on the heap using unique_ptr for exception safety
+        // Allocate output arrays on the heap using unique_ptr for exception safety.
+        // Outputs that were not requested are left unallocated so TUV-x skips them.
+        auto allocate = [outputs](musica::TuvxOutput output, std::size_t size)
+        { return (outputs & output) ? std::make_unique<std::vector<double>>(size) : nullptr; };
+        auto data = [](const std::unique_ptr<std::vector<double>>& values)
+        { return values ? values->data() : nullptr; };
         // (2D: reaction/heating reaction/dose rate type, vertical edge)
-        auto photolysis_rates = std::make_unique<std::vector<double>>(n_photolysis * (n_layers + 1));
-        auto heating_rates = std::make_unique<std::vector<double>>(n_heating * (n_layers + 1));
-        auto dose_rates = std::make_unique<std::vector<double>>(n_dose * (n_layers + 1));
+        auto photolysis_rates = allocate(musica::TuvxOutput::PHOTOLYSIS_RATE_CONSTANTS, n_photolysis * (n_layers + 1));
+        auto heating_rates = allocate(musica::TuvxOutput::HEATING_RATES, n_heating * (n_layers + 1));
+        auto dose_rates = allocate(musica::TuvxOutput::DOSE_RATES, n_dose * (n_layers + 1));
         // ... and 3D arrays for actinic flux and spectral irradiance
         // (wavelength, vertical edge, 3 components: direct, upwelling, downwelling)
-        auto actinic_flux = std::make_unique<std::vector<double>>(n_wavelengths * (n_layers + 1) * 3);
-        auto spectral_irradiance = std::make_unique<std::vector<double>>(n_wavelengths * (n_layers + 1) * 3);
+        auto actinic_flux = allocate(musica::TuvxOutput::ACTINIC_FLUX, n_wavelengths * (n_layers + 1) * 3);
+        auto spectral_irradiance = allocate(musica::TuvxOutput::SPECTRAL_IRRADIANCE, n_wavelengths * (n_layers + 1) * 3);
 
         // Run TUV-x
         musica::Error error;
         tuvx_instance->Run(
             sza_radians,
             earth_sun_distance,
-            photolysis_rates->data(),
-            heating_rates->data(),
-            dose_rates->data(),
-            actinic_flux->data(),
-            spectral_irradiance->data(),
+            data(photolysis_rates),
+            data(heating_rates),
+            data(dose_rates),
+            data(actinic_flux),
+            data(spectral_irradiance),
             &error);
 
         handle_error(error, "Error running TUV-x");
 
-        // Create capsules to manage the lifetime of the heap-allocated vectors
-        // Store data pointers before transferring ownership
-        double* photolysis_data = photolysis_rates->data();
-        double* heating_data = heating_rates->data();
-        double* dose_data = dose_rates->data();
-        double* actinic_flux_data = actinic_flux->data();
-        double* spectral_irradiance_data = spectral_irradiance->data();
+        // Create numpy arrays immediately after each capsule to ensure atomic ownership transfer;
+        // outputs that were not requested are returned as None
+        auto to_array = [](std::unique_ptr<std::vector<double>>& values, std::vector<py::ssize_t> shape) -> py::object
+        {
+          if (!values)
+            return py::none();
+          double* values_data = values->data();
+          auto capsule = py::capsule(values.get(), [](void* v) { delete reinterpret_cast<std::vector<double>*>(v); });
+          values.release();
+          return py::array_t<double>(shape, values_data, capsule);
+        };
 
-        // Create numpy arrays immediately after each capsule to ensure atomic ownership transfer
         // Return as numpy arrays with shape (reaction/heating reaction/dose rate type, vertical edge)
-        auto photolysis_capsule =
-            py::capsule(photolysis_rates.get(), [](void* v) { delete reinterpret_cast<std::vector<double>*>(v); });
-        photolysis_rates.release();
-        py::array_t<double> py_photolysis =
-            py::array_t<double>({ n_photolysis, n_layers + 1 }, photolysis_data, photolysis_capsule);
+        py::object py_photolysis = to_array(photolysis_rates, { n_photolysis, n_layers + 1 });
+        py::object py_heating = to_array(heating_rates, { n_heating, n_layers + 1 });
+        py::object py_dose = to_array(dose_rates, { n_dose, n_layers + 1 });
+        // ... and 3D arrays for actinic flux and spectral irradiance
+        // (wavelength, vertical edge, 3 components: direct, upwelling, downwelling)
+        py::object py_actinic_flux = to_array(actinic_flux, { n_wavelengths, n_layers + 1, 3 });
+        py::object py_spectral_irradiance = to_array(spectral_irradiance, { n_wavelengths, n_layers + 1, 3 });
 
-        auto heating_capsule =
-            py::capsule(heating_rates.get(), [](void* v) { delete reinterpret_cast<std::vector<double>*>(v); });
-        heating_rates.release();
-        py::array_t<double> py_heating = py::array_t<double>({ n_heating, n_layers + 1 }, heating_data, heating_capsule);
+        return py::make_tuple(py_photolysis, py_heating, py_dose, py_actinic_flux, py_spectral_irradiance);
+      },
+      "Run TUV-x (all parameters come from JSON config)",
+      py::arg("tuvx_instance"),
+      py::arg("sza_radians"),
+      py::arg("earth_sun_distance"),
+      py::arg("outputs") = static_cast<unsigned int>(musica::TuvxOutput::ALL_OUTPUTS));
 
-        auto dose_capsule = py::capsule(dose_rates.get(), [](void* v) { delete reinterpret_cast<std::vector<double>*>(v); });
-        dose_rates.release();
-        py::array_t<double> py_dose = py::array_t<double>({ n_dose, n_layers + 1 }, dose_data, dose_capsule);
+  tuvx.def(
+      "_run_tuvx_into",
+      [](std::uintptr_t tuvx_ptr,
+         double sza_radians,
+         double earth_sun_distance,
+         py::object photolysis_rates,
+         py::object heating_rates,
+         py::object dose_rates,
+         py::object actinic_flux,
+         py::object spectral_irradiance)
+      {
+        musica::TUVX* tuvx_instance = reinterpret_cast<musica::TUVX*>(tuvx_ptr);
 
+        // Get dimensions
+        py::ssize_t n_photolysis = tuvx_instance->GetPhotolysisRateConstantCount();
+        py::ssize_t n_heating = tuvx_instance->GetHeatingRateCount();
+        py::ssize_t n_dose = tuvx_instance->GetDoseRateCount();
+        py::ssize_t n_edges = tuvx_instance->GetNumberOfHeightMidpoints() + 1;
+        py::ssize_t n_wavelengths = tuvx_instance->GetNumberOfWavelengthMidpoints();
+
+        // Outputs are written in place, so buffers must already have the exact shape and layout TUV-x
+        // writes; None skips the output. Nothing is converted or copied, as a silent copy would be lost.
+        auto buffer = [](py::object& values, const char* name, std::vector<py::ssize_t> shape) -> double*
+        {
+          if (values.is_none())
+            return nullptr;
+          if (!py::isinstance<py::array>(values))
+            throw py::type_error(std::string("Output buffer '") + name + "' must be a NumPy array");
+          auto array = values.cast<py::array>();
+          if (!array.dtype().is(py::dtype::of<double>()))
+            throw py::type_error(std::string("Output buffer '") + name + "' must have dtype float64");
+          if (!(array.flags() & py::array::c_style) || !array.writeable())
+            throw py::value_error(std::string("Output buffer '") + name + "' must be writeable and C-contiguous");
+          if (array.ndim() != static_cast<py::ssize_t>(shape.size()) ||
+              !std::equal(shape.begin(), shape.end(), array.shape()))
+          {
+            std::string expected;
+            for (const auto dimension : shape)
+              expected += (expected.empty() ? "" : ", ") + std::to_string(dimension);
+            throw py::value_error(std::string("Output buffer '") + name + "' must have shape (" + expected + ")");
+          }
+          return static_cast<double*>(array.mutable_data());
+        };
+        // (2D: reaction/heating reaction/dose rate type, vertical edge)
+        double* photolysis_data = buffer(photolysis_rates, "photolysis_rate_constants", { n_photolysis, n_edges });
+        double* heating_data = buffer(heating_rates, "heating_rates", { n_heating, n_edges });
+        double* dose_data = buffer(dose_rates, "dose_rates", { n_dose, n_edges });
         // ... and 3D arrays for actinic flux and spectral irradiance
         // (wavelength, vertical edge, 3 components: direct, upwelling, downwelling)
-        auto actinic_flux_capsule =
-            py::capsule(actinic_flux.get(), [](void* v) { delete reinterpret_cast<std::vector<double>*>(v); });
-        actinic_flux.release();
-        py::array_t<double> py_actinic_flux =
-            py::array_t<double>({ n_wavelengths, n_layers + 1, 3 }, actinic_flux_data, actinic_flux_capsule);
-
-        auto spectral_irradiance_capsule =
-            py::capsule(spectral_irradiance.get(), [](void* v) { delete reinterpret_cast<std::vector<double>*>(v); });
-        spectral_irradiance.release();
-        py::array_t<double> py_spectral_irradiance =
-            py::array_t<double>({ n_wavelengths, n_layers + 1, 3 }, spectral_irradiance_data, spectral_irradiance_capsule);
+        double* actinic_flux_data = buffer(actinic_flux, "actinic_flux", { n_wavelengths, n_edges, 3 });
+        double* spectral_irradiance_data =
+            buffer(spectral_irradiance, "spectral_irradiance", { n_wavelengths, n_edges, 3 });
 
-        return py::make_tuple(py_photolysis, py_heating, py_dose, py_actinic_flux, py_spectral_irradiance);
+        // Run TUV-x
+        musica::Error error;
+        tuvx_instance->Run(
+            sza_radians,
+            earth_sun_distance,
+            photolysis_data,
+            heating_data,
+            dose_data,
+            actinic_flux_data,
+            spectral_irradiance_data,
+            &error);
+
+        handle_error(error, "Error running TUV-x");
       },
-      "Run TUV-x (all parameters come from JSON config)",
+      "Run TUV-x, writing the outputs into caller-provided NumPy arrays (None skips an output)",
       py::arg("tuvx_instance"),
       py::arg("sza_radians"),
-      py::arg("earth_sun_distance"));
+      py::arg("earth_sun_distance"),
+      py::arg("photolysis_rate_constants") = py::none(),
+      py::arg("heating_rates") = py::none(),
+      py::arg("dose_rates") = py::none(),
+      py::arg("actinic_flux") = py::none(),
+      py::arg("spectral_irradiance") = py::none());
 
   tuvx.def(
       "_get_grid_map",
@@ -1,6 +1,6 @@
 from .carma import (
     # Main classes
-    CARMA, CARMAParameters, CARMAState, CARMASurfaceProperties,
+    CARMA, CARMAParameters, CARMAState, CARMAColumnBatch, CARMASurfaceProperties,
 
     # Configuration classes
     CARMAGroupConfig, CARMAElementConfig, CARMASoluteConfig, CARMAGasConfig,
@@ -16,6 +16,39 @@ from .. import backend
 
 _backend = backend.get_backend()
 
+# Field order of the bulk state arrays filled by the CARMA backend
+_BIN_PROFILE_FIELDS = [
+    "mass_mixing_ratio",
+    "number_mixing_ratio",
+    "number_density",
+    "nucleation_rate",
+    "wet_particle_radius",
+    "wet_particle_density",
+    "dry_particle_density",
+    "delta_particle_temperature",
+    "kappa",
+    "total_mass_mixing_ratio"
+]
+_BIN_SURFACE_FIELDS = [
+    "particle_mass_on_surface",
+    "sedimentation_flux",
+    "deposition_velocity"
+]
+_GAS_FIELDS = [
+    "mass_mixing_ratio",
+    "gas_saturation_wrt_ice",
+    "gas_saturation_wrt_liquid",
+    "gas_vapor_pressure_wrt_ice",
+    "gas_vapor_pressure_wrt_liquid",
+    "weight_pct_aerosol_composition"
+]
+_ENVIRONMENTAL_FIELDS = [
+    "temperature",
+    "pressure",
+    "air_density",
+    "latent_heat"
+]
+
 
 class ParticleShape(Enum):
     """Enumeration for particle shapes used in CARMA."""
@@ -930,11 +963,81 @@ class CARMAState:
             radiative_intensity=radiative_intensity
         )
 
+    @classmethod
+    def _from_column_batch(cls, batch: 'CARMAColumnBatch', column_index: int, gases: List[CARMAGasConfig],
+                           **kwargs) -> 'CARMAState':
+        """Wrap the state of one column owned by a CARMAColumnBatch without creating a new state."""
+        state = cls.__new__(cls)
+        state.gases = gases or []
+        state.longitude = kwargs.get("longitude", 0.0)
+        state.latitude = kwargs.get("latitude", 0.0)
+        state.coordinates = kwargs.get("coordinates", CarmaCoordinates.CARTESIAN)
+        state.n_levels = len(kwargs["vertical_center"])
+        state.vertical_center = kwargs["vertical_center"]
+        state.vertical_levels = kwargs["vertical_levels"]
+        state.dimensions = batch.dimensions
+        state._batch = batch
+        state._carma_state_instance = _backend._carma._get_carma_column_batch_column(
+            batch._carma_column_batch_instance, column_index)
+        return state
+
     def __del__(self):
         """Clean up the CARMAState instance."""
+        # column states are owned and cleaned up by their CARMAColumnBatch
+        if getattr(self, '_batch', None) is not None:
+            return
         if hasattr(self, '_carma_state_instance') and self._carma_state_instance is not None:
             _backend._carma._delete_carma_state(self._carma_state_instance)
 
+    def reset(self,
+              vertical_center: List[float],
+              vertical_levels: List[float],
+              pressure: List[float],
+              pressure_levels: List[float],
+              temperature: List[float],
+              original_temperature: Optional[List[float]] = None,
+              relative_humidity: Optional[List[float]] = None,
+              specific_humidity: Optional[List[float]] = None,
+              radiative_intensity: Optional[List[List[float]]] = None,
+              time: float = 0.0,
+              time_step: float = 1.0,
+              latitude: float = 0.0,
+              longitude: float = 0.0,
+              coordinates: CarmaCoordinates = CarmaCoordinates.CARTESIAN,
+              ):
+        """
+        Load a new column into this state, reusing its existing allocation.
+
+        The arguments are the same as for a new CARMAState. As for a new state,
+        the bin, detrained and gas values must be set again before stepping.
+        """
+        self.longitude = longitude
+        self.latitude = latitude
+        self.coordinates = coordinates
+        self.n_levels = len(vertical_center)
+        if original_temperature is None:
+            original_temperature = temperature
+        self.vertical_center = vertical_center
+        self.vertical_levels = vertical_levels
+
+        _backend._carma._reset_carma_state(
+            carma_state_pointer=self._carma_state_instance,
+            time=time,
+            time_step=time_step,
+            latitude=latitude,
+            longitude=longitude,
+            coordinates=coordinates.value,
+            temperature=temperature,
+            original_temperature=original_temperature,
+            pressure=pressure,
+            pressure_levels=pressure_levels,
+            vertical_center=vertical_center,
+            vertical_levels=vertical_levels,
+            relative_humidity=relative_humidity,
+            specific_humidity=specific_humidity,
+            radiative_intensity=radiative_intensity
+        )
+
     def __repr__(self):
         """String representation of CARMAState."""
         return (f"CARMAState")
@@ -1045,6 +1148,122 @@ class CARMAState:
         """
         return _backend._carma._get_step_statistics(self._carma_state_instance)
 
+    def enable_timing(self, enabled: bool = True):
+        """
+        Enable or disable collection of interface-level timers and counters.
+
+        While enabled, get_step_statistics() reports under "timing" the number of timed
+        steps and the wall time spent in CARMA steps and in setting and getting state
+        values. Substep and retry counts of the last step are reported by
+        get_step_statistics() as before. Each CARMA step is timed as a whole; the
+        individual microphysical processes (coagulation, growth, sedimentation, ...) run
+        inside the CARMA library and are not timed separately.
+
+        Args:
+            enabled: Whether to collect timers and counters (default: True)
+        """
+        _backend._carma._enable_timing(self._carma_state_instance, enabled)
+
+    def reset_timing(self):
+        """Reset the timers and counters to zero."""
+        _backend._carma._reset_timing(self._carma_state_instance)
+
+    def _bulk_buffers(self) -> Dict[str, np.ndarray]:
+        """Buffers filled in place by the bulk getters, allocated on first use."""
+        if getattr(self, '_bulk_buffer_cache', None) is None:
+            n_levels = len(self.vertical_center)
+            n_bins = self.dimensions["number_of_bins"]
+            n_elements = self.dimensions["number_of_elements"]
+            n_gases = self.dimensions["number_of_gases"]
+            self._bulk_buffer_cache = {
+                "bin_profiles": np.zeros((len(_BIN_PROFILE_FIELDS), n_elements, n_bins, n_levels)),
+                "fall_velocity": np.zeros((n_elements, n_bins, n_levels + 1)),
+                "bin_surface": np.zeros((len(_BIN_SURFACE_FIELDS), n_elements, n_bins)),
+                "gases": np.zeros((len(_GAS_FIELDS), n_gases, n_levels)),
+                "environment": np.zeros((len(_ENVIRONMENTAL_FIELDS), n_levels))
+            }
+        return self._bulk_buffer_cache
+
+    def get_bin_arrays(self) -> Dict[str, np.ndarray]:
+        """
+        Get the values of every bin and element as NumPy arrays in one call.
+
+        The arrays are views into buffers owned by this state and are overwritten by the
+        next call; copy them to keep values between steps.
+
+        Returns:
+            Dict[str, np.ndarray]: Per-level properties with shape (element, bin, vertical_center),
+            fall_velocity with shape (element, bin, vertical_level) and surface properties with
+            shape (element, bin)
+        """
+        buffers = self._bulk_buffers()
+        _backend._carma._get_bins_into(
+            self._carma_state_instance, buffers["bin_profiles"], buffers["fall_velocity"], buffers["bin_surface"])
+        arrays = {name: buffers["bin_profiles"][i] for i, name in enumerate(_BIN_PROFILE_FIELDS)}
+        arrays.update({name: buffers["bin_surface"][i] for i, name in enumerate(_BIN_SURFACE_FIELDS)})
+        arrays["fall_velocity"] = buffers["fall_velocity"]
+        return arrays
+
+    def set_bin_arrays(self, mass_mixing_ratio: np.ndarray, surface_mass: Optional[np.ndarray] = None):
+        """
+        Set the mass mixing ratios of every bin and element in one call.
+
+        Args:
+            mass_mixing_ratio: Mass mixing ratios [kg kg-1] with shape (element, bin, vertical_center)
+            surface_mass: Element masses on the surface [kg m-2] with shape (element, bin) (default: None, 0)
+        """
+        _backend._carma._set_bins_from_array(
+            self._carma_state_instance, mass_mixing_ratio, surface_mass)
+
+    def get_gas_arrays(self) -> Dict[str, np.ndarray]:
+        """
+        Get the values of every gas as NumPy arrays with shape (gas, vertical_center) in one call.
+
+        The arrays are views into buffers owned by this state and are overwritten by the
+        next call; copy them to keep values between steps.
+
+        Returns:
+            Dict[str, np.ndarray]: Gas properties indexed by property name
+        """
+        buffers = self._bulk_buffers()
+        _backend._carma._get_gases_into(self._carma_state_instance, buffers["gases"])
+        return {name: buffers["gases"][i] for i, name in enumerate(_GAS_FIELDS)}
+
+    def set_gas_arrays(self,
+                       mass_mixing_ratio: np.ndarray,
+                       old_mmr: Optional[np.ndarray] = None,
+                       gas_saturation_wrt_ice: Optional[np.ndarray] = None,
+                       gas_saturation_wrt_liquid: Optional[np.ndarray] = None):
+        """
+        Set the profiles of every gas in one call. All arrays have shape (gas, vertical_center).
+
+        Args:
+            mass_mixing_ratio: Mass mixing ratios [kg kg-1]
+            old_mmr: Original mass mixing ratios [kg kg-1] (default: None)
+            gas_saturation_wrt_ice: Gas saturation with respect to ice (default: None)
+            gas_saturation_wrt_liquid: Gas saturation with respect to liquid (default: None)
+        """
+        _backend._carma._set_gases_from_array(
+            self._carma_state_instance,
+            mass_mixing_ratio,
+            old_mmr=old_mmr,
+            gas_saturation_wrt_ice=gas_saturation_wrt_ice,
+            gas_saturation_wrt_liquid=gas_saturation_wrt_liquid)
+
+    def get_environmental_arrays(self) -> Dict[str, np.ndarray]:
+        """
+        Get the environmental values as NumPy arrays with shape (vertical_center,) in one call.
+
+        The arrays are views into buffers owned by this state and are overwritten by the
+        next call; copy them to keep values between steps.
+
+        Returns:
+            Dict[str, np.ndarray]: Environmental values indexed by name
+        """
+        buffers = self._bulk_buffers()
+        _backend._carma._get_environmental_values_into(self._carma_state_instance, buffers["environment"])
+        return {name: buffers["environment"][i] for i, name in enumerate(_ENVIRONMENTAL_FIELDS)}
+
     def get_bins(self) -> xr.Dataset:
         """
         Get the CARMA aerosol state data for all bins and elements.
@@ -1102,17 +1321,8 @@ class CARMAState:
             "deposition_velocity"
         ]
 
-        # Prepare arrays
-        data = {prop: [] for prop in properties}
-        for i_bin in range(number_of_bins):
-            for i_elem in range(number_of_elements):
-                bin_value = _backend._carma._get_bin(
-                    self._carma_state_instance,
-                    i_bin + 1,
-                    i_elem + 1
-                )
-                for prop in properties:
-                    data[prop].append(bin_value.get(prop))
+        # Bulk arrays are (element, bin, ...); the dataset is (bin, element, ...)
+        data = {prop: np.swapaxes(values, 0, 1) for prop, values in self.get_bin_arrays().items()}
 
         # Reshape arrays
         def reshape(arr, shape):
@@ -1291,15 +1501,7 @@ class CARMAState:
             "weight_pct_aerosol_composition"
         ]
 
-        # Prepare arrays
-        data = {prop: [] for prop in properties}
-        for i_gas in range(number_of_gases):
-            gas_value = _backend._carma._get_gas(
-                self._carma_state_instance,
-                i_gas + 1
-            )
-            for prop in properties:
-                data[prop].append(gas_value.get(prop))
+        data = self.get_gas_arrays()
 
         # Reshape arrays
         def reshape(arr, shape):
@@ -1344,7 +1546,7 @@ class CARMAState:
         """
         n_levels = len(self.vertical_center)
 
-        data = _backend._carma._get_environmental_values(self._carma_state_instance)
+        data = self.get_environmental_arrays()
 
         # Reshape arrays
         def reshape(arr, shape):
@@ -1442,6 +1644,100 @@ class CARMAState:
         )
 
 
+class CARMAColumnBatch:
+    """
+    A set of CARMA column states created from one CARMA instance that are stepped
+    concurrently on a pool of worker threads."""
+
+    def __init__(self,
+                 carma_pointer: c_void_p,
+                 columns: List[Dict[str, Any]],
+                 number_of_threads: int = 1,
+                 gases: Optional[List[CARMAGasConfig]] = None,
+                 ):
+        """
+        Initialize a CARMAColumnBatch instance.
+
+        Args:
+            carma_pointer: Pointer to the CARMA C++ instance
+            columns: List of keyword-argument dictionaries, one per column, accepted by CARMAState
+            number_of_threads: Number of worker threads (default: 1; 0 uses the number of hardware threads)
+            gases: List of gas configurations
+        """
+        self.dimensions = _backend._carma._get_dimensions(carma_pointer)
+        column_kwargs = []
+        for column in columns:
+            kwargs = dict(column)
+            if kwargs.get("original_temperature") is None:
+                kwargs["original_temperature"] = kwargs["temperature"]
+            kwargs.setdefault("time_step", 1.0)
+            kwargs["coordinates"] = kwargs.get("coordinates", CarmaCoordinates.CARTESIAN).value
+            column_kwargs.append(kwargs)
+        self._carma_column_batch_instance = _backend._carma._create_carma_column_batch(
+            carma_pointer, column_kwargs, number_of_threads)
+        self.number_of_threads = _backend._carma._get_carma_column_batch_number_of_threads(
+            self._carma_column_batch_instance)
+        self.columns = [
+            CARMAState._from_column_batch(self, i_column, gases, **dict(column))
+            for i_column, column in enumerate(columns)
+        ]
+
+    def __del__(self):
+        """Clean up the CARMAColumnBatch instance."""
+        if hasattr(self, '_carma_column_batch_instance') and self._carma_column_batch_instance is not None:
+            _backend._carma._delete_carma_column_batch(self._carma_column_batch_instance)
+
+    def __len__(self):
+        """Number of columns in the batch."""
+        return len(self.columns)
+
+    def __getitem__(self, column_index: int) -> CARMAState:
+        """Get the CARMAState of one column."""
+        return self.columns[column_index]
+
+    def __repr__(self):
+        """String representation of CARMAColumnBatch."""
+        return f"CARMAColumnBatch(columns={len(self.columns)}, threads={self.number_of_threads})"
+
+    def __str__(self):
+        """String representation of CARMAColumnBatch."""
+        return self.__repr__()
+
+    def step(self, step_configs: Union[Dict[str, Any], List[Dict[str, Any]], None] = None):
+        """
+        Perform a single step in the CARMA simulation for every column concurrently.
+
+        Args:
+            step_configs: Keyword arguments accepted by CARMAState.step, either one dictionary
+                applied to all columns or a list with one dictionary per column (default: None)
+        """
+        if step_configs is None:
+            step_configs = {}
+        if isinstance(step_configs, dict):
+            step_configs = [step_configs] * len(self.columns)
+        _backend._carma._step_carma_column_batch(
+            self._carma_column_batch_instance, list(step_configs))
+
+    def get_step_statistics(self) -> List[Dict[str, Any]]:
+        """
+        Get the step statistics of the last step for each column.
+
+        Returns:
+            List of dictionaries containing the step statistics, indexed by column
+        """
+        return _backend._carma._get_carma_column_batch_step_statistics(self._carma_column_batch_instance)
+
+    def enable_timing(self, enabled: bool = True):
+        """
+        Enable or disable collection of interface-level timers and counters for every column.
+
+        Args:
+            enabled: Whether to collect timers and counters (default: True)
+        """
+        for column in self.columns:
+            column.enable_timing(enabled)
+
+
 class CARMA:
     """
     A Python interface to the CARMA aerosol model.
@@ -1495,6 +1791,25 @@ class CARMA:
             **kwargs
         )
 
+    def create_column_batch(self, columns: List[Dict[str, Any]], number_of_threads: int = 1) -> CARMAColumnBatch:
+        """
+        Create a CARMAColumnBatch with one CARMAState per column that are stepped concurrently.
+
+        Args:
+            columns: List of keyword-argument dictionaries, one per column, accepted by CARMAState
+            number_of_threads: Number of worker threads (default: 1; 0 uses the number of hardware threads)
+
+        Returns:
+            CARMAColumnBatch: Instance owning the column states
+        """
+
+        return CARMAColumnBatch(
+            self._carma_instance,
+            columns,
+            number_of_threads=number_of_threads,
+            gases=self.__parameters.gases
+        )
+
     def get_group_properties(self) -> Tuple[xr.Dataset, Dict[str, int]]:
         """
         Get the group properties for all groups.
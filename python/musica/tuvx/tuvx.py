@@ -11,7 +11,7 @@ Note: TUV-x is only available on macOS and Linux platforms.
 import os
 import json
 import tempfile
-from typing import Dict, Optional
+from typing import Dict, Iterable, Optional
 import numpy as np
 import xarray as xr
 from .. import backend
@@ -22,6 +22,10 @@ from .radiator_map import RadiatorMap
 
 _backend = backend.get_backend()
 
+# Names of the data variables that TUVX.run can calculate
+_OUTPUT_NAMES = ('photolysis_rate_constants', 'heating_rates', 'dose_rates',
+                 'actinic_flux', 'spectral_irradiance')
+
 
 class TUVX:
     """
@@ -136,7 +140,8 @@ class TUVX:
                 self._tuvx_instance)
         return self._dose_names
 
-    def run(self, sza: float, earth_sun_distance: float) -> xr.Dataset:
+    def run(self, sza: float, earth_sun_distance: float,
+            outputs: Optional[Iterable[str]] = None) -> xr.Dataset:
         """
         Run the TUV-x photolysis calculator.
 
@@ -146,6 +151,10 @@ class TUVX:
         Args:
             sza: Solar zenith angle in radians
             earth_sun_distance: Earth-Sun distance in astronomical units (AU)
+            outputs: Names of the data variables to calculate (any of 'photolysis_rate_constants',
+                'heating_rates', 'dose_rates', 'actinic_flux', 'spectral_irradiance').
+                Outputs that are not requested are not calculated or allocated and are left
+                out of the returned Dataset. Defaults to all outputs.
 
         Returns:
             XArray Dataset with data variables:
@@ -154,10 +163,23 @@ class TUVX:
             - dose_rates: Shape (n_dose_rates, n_vertical_edge) [W m^-2]
             - actinic_flux: Shape (n_wavelengths, n_vertical_edge, 3 components: direct, upwelling, downwelling) [photons cm^-2 s^-1 nm^-1]
             - spectral_irradiance: Shape (n_wavelengths, n_vertical_edge, 3 components: direct, upwelling, downwelling) [W m^-2 nm^-1]
+
+        Raises:
+            ValueError: If an unknown output name is requested
         """
+        output_flags = _backend._tuvx._TuvxOutput
+        output_mask = int(output_flags.ALL_OUTPUTS)
+        if outputs is not None:
+            output_mask = 0
+            for output in outputs:
+                if output not in _OUTPUT_NAMES:
+                    raise ValueError(
+                        f"Unknown TUV-x output '{output}'. Valid outputs are {_OUTPUT_NAMES}")
+                output_mask |= int(getattr(output_flags, output.upper()))
+
         photolysis_rates, heating_rates, dose_rates, actinic_flux, \
             spectral_irradiance = _backend._tuvx._run_tuvx(
-                self._tuvx_instance, sza, earth_sun_distance)
+                self._tuvx_instance, sza, earth_sun_distance, output_mask)
 
         # Create arrays of names sorted by index
         reaction_names = [name for name, _ in sorted(
@@ -171,48 +193,52 @@ class TUVX:
         )]
         radiation_components = ['direct', 'upwelling', 'downwelling']
 
-        # Sanity check on array dimensions
-        assert photolysis_rates.shape[0] == len(reaction_names), \
-            f"Photolysis rates shape does not match number of reactions {photolysis_rates.shape[0]} /= {len(reaction_names)}"
-        assert heating_rates.shape[0] == len(heating_names), \
-            f"Heating rates shape does not match number of heating rates {heating_rates.shape[0]} /= {len(heating_names)}"
-        assert dose_rates.shape[0] == len(dose_names), \
-            f"Dose rates shape does not match number of dose rates {dose_rates.shape[0]} /= {len(dose_names)}"
-        assert actinic_flux.shape[2] == len(radiation_components), \
-            f"Actinic flux shape does not match number of radiation components {actinic_flux.shape[2]} /= {len(radiation_components)}"
-        assert spectral_irradiance.shape[2] == len(radiation_components), \
-            f"Spectral irradiance shape does not match number of radiation components {spectral_irradiance.shape[2]} /= {len(radiation_components)}"
-
         # Get the height and wavelength grids from the GridMap
         grids = self.get_grid_map()
         height_grid = grids["height", "km"]
         wavelength_grid = grids["wavelength", "nm"]
 
-        # Sanity check on height grid dimensions
-        assert height_grid.edges.size == photolysis_rates.shape[1], \
-            f"Height grid sections do not match number of layers in photolysis rates {height_grid.edges.size} /= {photolysis_rates.shape[1]}"
-        assert height_grid.edges.size == heating_rates.shape[1], \
-            f"Height grid sections do not match number of layers in heating rates {height_grid.edges.size} /= {heating_rates.shape[1]}"
-        assert height_grid.edges.size == dose_rates.shape[1], \
-            f"Height grid sections do not match number of layers in dose rates {height_grid.edges.size} /= {dose_rates.shape[1]}"
-        assert height_grid.edges.size == actinic_flux.shape[1], \
-            f"Height grid sections do not match number of layers in actinic flux {height_grid.edges.size} /= {actinic_flux.shape[1]}"
-        assert height_grid.edges.size == spectral_irradiance.shape[1], \
-            f"Height grid sections do not match number of layers in spectral irradiance {height_grid.edges.size} /= {spectral_irradiance.shape[1]}"
-        # Sanity check on wavelength grid dimensions
-        assert wavelength_grid.midpoints.size == actinic_flux.shape[0], \
-            f"Wavelength grid sections do not match number of wavelengths in actinic flux {wavelength_grid.midpoints.size} /= {actinic_flux.shape[0]}"
-        assert wavelength_grid.midpoints.size == spectral_irradiance.shape[0], \
-            f"Wavelength grid sections do not match number of wavelengths in spectral irradiance {wavelength_grid.midpoints.size} /= {spectral_irradiance.shape[0]}"
+        # Sanity check on array dimensions
+        if photolysis_rates is not None:
+            assert photolysis_rates.shape[0] == len(reaction_names), \
+                f"Photolysis rates shape does not match number of reactions {photolysis_rates.shape[0]} /= {len(reaction_names)}"
+            assert height_grid.edges.size == photolysis_rates.shape[1], \
+                f"Height grid sections do not match number of layers in photolysis rates {height_grid.edges.size} /= {photolysis_rates.shape[1]}"
+        if heating_rates is not None:
+            assert heating_rates.shape[0] == len(heating_names), \
+                f"Heating rates shape does not match number of heating rates {heating_rates.shape[0]} /= {len(heating_names)}"
+            assert height_grid.edges.size == heating_rates.shape[1], \
+                f"Height grid sections do not match number of layers in heating rates {height_grid.edges.size} /= {heating_rates.shape[1]}"
+        if dose_rates is not None:
+            assert dose_rates.shape[0] == len(dose_names), \
+                f"Dose rates shape does not match number of dose rates {dose_rates.shape[0]} /= {len(dose_names)}"
+            assert height_grid.edges.size == dose_rates.shape[1], \
+                f"Height grid sections do not match number of layers in dose rates {height_grid.edges.size} /= {dose_rates.shape[1]}"
+        if actinic_flux is not None:
+            assert actinic_flux.shape[2] == len(radiation_components), \
+                f"Actinic flux shape does not match number of radiation components {actinic_flux.shape[2]} /= {len(radiation_components)}"
+            assert height_grid.edges.size == actinic_flux.shape[1], \
+                f"Height grid sections do not match number of layers in actinic flux {height_grid.edges.size} /= {actinic_flux.shape[1]}"
+            assert wavelength_grid.midpoints.size == actinic_flux.shape[0], \
+                f"Wavelength grid sections do not match number of wavelengths in actinic flux {wavelength_grid.midpoints.size} /= {actinic_flux.shape[0]}"
+        if spectral_irradiance is not None:
+            assert spectral_irradiance.shape[2] == len(radiation_components), \
+                f"Spectral irradiance shape does not match number of radiation components {spectral_irradiance.shape[2]} /= {len(radiation_components)}"
+            assert height_grid.edges.size == spectral_irradiance.shape[1], \
+                f"Height grid sections do not match number of layers in spectral irradiance {height_grid.edges.size} /= {spectral_irradiance.shape[1]}"
+            assert wavelength_grid.midpoints.size == spectral_irradiance.shape[0], \
+                f"Wavelength grid sections do not match number of wavelengths in spectral irradiance {wavelength_grid.midpoints.size} /= {spectral_irradiance.shape[0]}"
+
         dataset_vars = {
             'photolysis_rate_constants': (('reaction', 'vertical_edge'), photolysis_rates, {'units': 's^-1'}),
             'heating_rates': (('heating_rate', 'vertical_edge'), heating_rates, {'units': 'K s^-1'}),
             'dose_rates': (('dose_rate', 'vertical_edge'), dose_rates, {'units': 'W m^-2'}),
             'actinic_flux': (('wavelength_midpoint', 'vertical_edge', 'component'), actinic_flux, {'units': 'photons cm^-2 s^-1 nm^-1'}),
             'spectral_irradiance': (('wavelength_midpoint', 'vertical_edge', 'component'), spectral_irradiance, {'units': 'W m^-2 nm^-1'}),
-            "solar_zenith_angle": ((), sza, {'units': 'radians'}),
-            "earth_sun_distance": ((), earth_sun_distance, {'units': 'AU'}),
         }
+        dataset_vars = {name: var for name, var in dataset_vars.items() if var[1] is not None}
+        dataset_vars["solar_zenith_angle"] = ((), sza, {'units': 'radians'})
+        dataset_vars["earth_sun_distance"] = ((), earth_sun_distance, {'units': 'AU'})
 
         return xr.Dataset(
             data_vars=dataset_vars,
@@ -228,6 +254,65 @@ class TUVX:
             }
         )
 
+    def allocate_outputs(self, outputs: Optional[Iterable[str]] = None) -> Dict[str, np.ndarray]:
+        """
+        Allocate output buffers for use with `run_into`.
+
+        Args:
+            outputs: Names of the outputs to allocate (any of 'photolysis_rate_constants',
+                'heating_rates', 'dose_rates', 'actinic_flux', 'spectral_irradiance').
+                Defaults to all outputs.
+
+        Returns:
+            Dictionary mapping each output name to a zero-filled array with the shape
+            described in `run`
+
+        Raises:
+            ValueError: If an unknown output name is requested
+        """
+        names = _OUTPUT_NAMES if outputs is None else tuple(outputs)
+        for name in names:
+            if name not in _OUTPUT_NAMES:
+                raise ValueError(
+                    f"Unknown TUV-x output '{name}'. Valid outputs are {_OUTPUT_NAMES}")
+        grids = self.get_grid_map()
+        n_edges = grids["height", "km"].edges.size
+        n_wavelengths = grids["wavelength", "nm"].midpoints.size
+        shapes = {
+            'photolysis_rate_constants': (len(self.photolysis_rate_names), n_edges),
+            'heating_rates': (len(self.heating_rate_names), n_edges),
+            'dose_rates': (len(self.dose_rate_names), n_edges),
+            'actinic_flux': (n_wavelengths, n_edges, 3),
+            'spectral_irradiance': (n_wavelengths, n_edges, 3),
+        }
+        return {name: np.zeros(shapes[name], dtype=np.float64) for name in names}
+
+    def run_into(self, sza: float, earth_sun_distance: float, out: Dict[str, np.ndarray]) -> None:
+        """
+        Run the TUV-x photolysis calculator, writing the results into existing arrays.
+
+        This avoids the output allocation and Dataset construction of `run`, and is intended
+        for time-stepping loops that reuse the same buffers on every call (see `allocate_outputs`).
+        Only the outputs present in `out` are calculated.
+
+        Args:
+            sza: Solar zenith angle in radians
+            earth_sun_distance: Earth-Sun distance in astronomical units (AU)
+            out: Dictionary mapping output names to writeable, C-contiguous float64 arrays
+                with the shapes described in `run`
+
+        Raises:
+            ValueError: If an unknown output name is given or a buffer has the wrong shape or layout
+            TypeError: If a buffer is not a float64 NumPy array
+        """
+        for name in out:
+            if name not in _OUTPUT_NAMES:
+                raise ValueError(
+                    f"Unknown TUV-x output '{name}'. Valid outputs are {_OUTPUT_NAMES}")
+        _backend._tuvx._run_tuvx_into(
+            self._tuvx_instance, sza, earth_sun_distance,
+            *(out.get(name) for name in _OUTPUT_NAMES))
+
     def get_grid_map(self) -> GridMap:
         """
         Get the GridMap used in this TUV-x instance.
@@ -213,6 +213,20 @@ def test_carma_with_all_components():
                    aerodynamic_resistance=0.1),
                ice=musica.carma.CARMASurfaceProperties(area_fraction=0.2))
     print(state.get_step_statistics())
+
+    state.reset(
+        vertical_center=[16500.0],
+        vertical_levels=[16500.0, 17000.0],
+        pressure=[85000.0],
+        pressure_levels=[101325.0, 85050.0],
+        temperature=[270.0],
+        time_step=900.0,
+        longitude=30.0
+    )
+    assert state.get_environmental_values()["temperature"].values[0] == pytest.approx(270.0)
+    state.set_bin(1, 1, 1.0)
+    state.set_gas(1, 1.4e-3)
+    state.step()
     print(state.get_bins())
     print(state.get_detrained_masses())
     print(state.get_environmental_values())
@@ -223,5 +237,137 @@ def test_carma_with_all_components():
     print(carma.get_solute_properties())
 
 
+def _single_group_parameters():
+    """Small one-group, one-element aluminum setup"""
+    params = musica.carma.CARMAParameters()
+    params.nz = 1
+    params.nbin = 3
+    params.dtime = 900.0
+    params.wavelength_bins = [
+        musica.carma.CARMAWavelengthBin(
+            center=550e-9, width=50e-9, do_emission=True)
+    ]
+    params.groups.append(musica.carma.CARMAGroupConfig(
+        name="aluminum",
+        shortname="ALUM",
+        rmin=1e-8,
+        rmrat=2.0,
+        ishape=musica.carma.ParticleShape.SPHERE,
+        eshape=1.0,
+        do_vtran=True,
+        df=[1.8, 1.8, 1.8]
+    ))
+    params.elements.append(musica.carma.CARMAElementConfig(
+        igroup=1,
+        name="Aluminum",
+        shortname="AL",
+        rho=2.70,
+        itype=musica.carma.ParticleType.INVOLATILE,
+        icomposition=musica.carma.ParticleComposition.ALUMINUM
+    ))
+    return params
+
+
+def test_carma_column_batch():
+    """Test stepping several CARMA columns concurrently"""
+    params = _single_group_parameters()
+    carma = musica.carma.CARMA(params)
+
+    columns = [
+        dict(
+            vertical_center=[16500.0],
+            vertical_levels=[16500.0, 17000.0],
+            pressure=[90000.0],
+            pressure_levels=[101325.0, 90050.0],
+            temperature=[260.0 + 10.0 * i_column],
+            time_step=900.0,
+            longitude=10.0 * i_column,
+        )
+        for i_column in range(4)
+    ]
+    batch = carma.create_column_batch(columns, number_of_threads=2)
+    assert isinstance(batch, musica.carma.CARMAColumnBatch)
+    assert len(batch) == 4
+    assert batch.number_of_threads == 2
+
+    for i_column, state in enumerate(batch):
+        state.set_bin(1, 1, 1.0e-9 * (i_column + 1))
+    batch.step([dict(land=musica.carma.CARMASurfaceProperties(surface_friction_velocity=0.42))] * 4)
+    batch.step()
+
+    statistics = batch.get_step_statistics()
+    assert len(statistics) == 4
+
+    # each column matches the same column stepped on its own
+    for i_column, column in enumerate(columns):
+        state = carma.create_state(**column)
+        state.set_bin(1, 1, 1.0e-9 * (i_column + 1))
+        state.step(land=musica.carma.CARMASurfaceProperties(surface_friction_velocity=0.42))
+        state.step()
+        assert statistics[i_column]["total_number_of_substeps"] == \
+            state.get_step_statistics()["total_number_of_substeps"]
+        expected = state.get_bins()
+        actual = batch[i_column].get_bins()
+        for name in expected.data_vars:
+            assert actual[name].equals(expected[name]), name
+
+    with pytest.raises(ValueError):
+        batch.step([{}] * 3)
+
+
+def test_carma_bulk_arrays():
+    """Test the NumPy bulk getters and setters against the per-bin interface"""
+    import numpy as np
+
+    params = _single_group_parameters()
+    params.gases.append(musica.carma.CARMAGasConfig(
+        name="water",
+        shortname="H2O",
+        wtmol=18.015,
+        ivaprtn=musica.carma.VaporizationAlgorithm.H2O_MURPHY_2005,
+        icomposition=musica.carma.GasComposition.H2O,
+        dgc_threshold=0.1,
+        ds_threshold=0.1
+    ))
+    carma = musica.carma.CARMA(params)
+    state = carma.create_state(
+        vertical_center=[16500.0],
+        vertical_levels=[16500.0, 17000.0],
+        pressure=[90000.0],
+        pressure_levels=[101325.0, 90050.0],
+        temperature=[260.0],
+        time_step=900.0
+    )
+
+    mass_mixing_ratio = np.arange(1.0, 4.0).reshape((1, 3, 1)) * 1.0e-9
+    state.set_bin_arrays(mass_mixing_ratio)
+    state.set_gas_arrays(np.full((1, 1), 1.4e-3))
+    with pytest.raises(ValueError):
+        state.set_bin_arrays(np.zeros((3, 1, 1)))
+
+    bins = state.get_bin_arrays()
+    assert bins["mass_mixing_ratio"].shape == (1, 3, 1)
+    assert bins["fall_velocity"].shape == (1, 3, 2)
+    assert bins["deposition_velocity"].shape == (1, 3)
+    np.testing.assert_allclose(bins["mass_mixing_ratio"], mass_mixing_ratio)
+    np.testing.assert_allclose(state.get_gas_arrays()["mass_mixing_ratio"], [[1.4e-3]])
+
+    state.enable_timing()
+    state.step()
+    timing = state.get_step_statistics()["timing"]
+    assert timing["enabled"]
+    assert timing["number_of_steps"] == 1
+    assert timing["step_time"] > 0.0
+    bins = state.get_bin_arrays()
+    dataset = state.get_bins()
+    for name in ["mass_mixing_ratio", "number_density", "wet_particle_radius", "fall_velocity",
+                 "sedimentation_flux"]:
+        np.testing.assert_array_equal(np.swapaxes(bins[name], 0, 1), dataset[name].values)
+
+    environment = state.get_environmental_arrays()
+    assert environment["temperature"].shape == (1,)
+    np.testing.assert_array_equal(environment["pressure"], state.get_environmental_values()["pressure"].values)
+
+
 if __name__ == '__main__':
     pytest.main([__file__])
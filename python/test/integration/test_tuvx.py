@@ -236,6 +236,85 @@ def test_fixed_tuvx_from_file():
     assert dataset["dose_rates"].shape[0] == len(dose_names_1), "Dose rates shape mismatch"
 
 
+def test_fixed_tuvx_selected_outputs():
+    file = find_config_path("tuvx", "full_from_host", "config_python.json")
+    grid_map = get_fixed_grid_map()
+    profile_map = get_profile_map(grid_map)
+    radiator_map = get_radiator_map(grid_map)
+    tuvx = musica.TUVX(grid_map, profile_map, radiator_map, config_path=file)
+
+    # a daytime solar zenith angle so the selected output is not zero-filled
+    sza = 0.1
+    full = tuvx.run(sza, 1.0)
+    assert np.any(full["photolysis_rate_constants"].values > 0), "All photolysis rates are zero"
+    photolysis_only = tuvx.run(sza, 1.0, outputs=["photolysis_rate_constants"])
+
+    assert "photolysis_rate_constants" in photolysis_only
+    for name in ("heating_rates", "dose_rates", "actinic_flux", "spectral_irradiance"):
+        assert name not in photolysis_only, f"Unrequested output {name} was returned"
+    np.testing.assert_allclose(
+        photolysis_only["photolysis_rate_constants"].values,
+        full["photolysis_rate_constants"].values,
+        rtol=1e-12)
+
+    # buffers for the outputs that were not selected are left untouched
+    sentinel = -12.5
+    out = tuvx.allocate_outputs()
+    for array in out.values():
+        array.fill(sentinel)
+    tuvx.run_into(sza, 1.0, out={"photolysis_rate_constants": out["photolysis_rate_constants"]})
+    np.testing.assert_allclose(out["photolysis_rate_constants"],
+                               full["photolysis_rate_constants"].values, rtol=1e-12)
+    for name in ("heating_rates", "dose_rates", "actinic_flux", "spectral_irradiance"):
+        assert np.all(out[name] == sentinel), f"Unselected output {name} was modified"
+
+    with pytest.raises(ValueError):
+        tuvx.run(sza, 1.0, outputs=["not_an_output"])
+
+
+def test_fixed_tuvx_run_into():
+    file = find_config_path("tuvx", "full_from_host", "config_python.json")
+    grid_map = get_fixed_grid_map()
+    profile_map = get_profile_map(grid_map)
+    radiator_map = get_radiator_map(grid_map)
+    tuvx = musica.TUVX(grid_map, profile_map, radiator_map, config_path=file)
+
+    # a daytime solar zenith angle so the outputs are calculated rather than zero-filled
+    sza = 0.1
+    full = tuvx.run(sza, 1.0)
+    assert np.any(full["photolysis_rate_constants"].values > 0), "All photolysis rates are zero"
+    out = tuvx.allocate_outputs()
+    buffers = {name: id(array) for name, array in out.items()}
+    for _ in range(2):
+        assert tuvx.run_into(sza, 1.0, out=out) is None
+    for name, array in out.items():
+        assert id(array) == buffers[name], f"Buffer for {name} was replaced"
+        np.testing.assert_allclose(array, full[name].values, rtol=1e-12)
+
+    # reused buffers are overwritten with the results for the new conditions
+    later = tuvx.run(0.5, 1.0)
+    tuvx.run_into(0.5, 1.0, out=out)
+    for name, array in out.items():
+        np.testing.assert_allclose(array, later[name].values, rtol=1e-12)
+    assert not np.allclose(out["photolysis_rate_constants"], full["photolysis_rate_constants"].values)
+
+    # only the outputs that are passed are calculated
+    photolysis_only = tuvx.allocate_outputs(["photolysis_rate_constants"])
+    tuvx.run_into(sza, 1.0, out=photolysis_only)
+    assert list(photolysis_only) == ["photolysis_rate_constants"]
+    np.testing.assert_allclose(photolysis_only["photolysis_rate_constants"],
+                               full["photolysis_rate_constants"].values, rtol=1e-12)
+
+    with pytest.raises(ValueError):
+        tuvx.run_into(sza, 1.0, out={"not_an_output": out["dose_rates"]})
+    with pytest.raises(ValueError):
+        tuvx.run_into(sza, 1.0, out={"dose_rates": out["dose_rates"][:, :-1]})
+    with pytest.raises(ValueError):
+        tuvx.run_into(sza, 1.0, out={"dose_rates": np.asfortranarray(np.zeros(out["dose_rates"].shape))})
+    with pytest.raises(TypeError):
+        tuvx.run_into(sza, 1.0, out={"dose_rates": out["dose_rates"].astype(np.float32)})
+
+
 def test_fixed_tuvx_from_string():
     file = find_config_path("tuvx", "full_from_host", "config_python.json")
     with open(file, 'r') as f:
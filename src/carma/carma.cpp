@@ -7,35 +7,232 @@
 #include <musica/carma/carma_c_interface.hpp>
 #include <musica/carma/error.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
+#include <mutex>
+#include <new>
 #include <stdexcept>
+#include <vector>
 
 namespace musica
 {
-  CARMA::CARMA(const CARMAParameters& params)
-      : carma_parameters_(params),
-        c_carma_parameters_(ToCCompatible(params)),
-        f_carma_type_(nullptr)
+  /// @brief An initialized Fortran CARMA instance and the C-compatible parameters it was created from
+  struct CARMASharedInstance
   {
-    int rc = 0;
-    f_carma_type_ = InternalCreateCarma(*c_carma_parameters_, &rc);
-    if (rc != 0)
+    CCARMAParameters* c_parameters = nullptr;
+    void* f_carma_type = nullptr;
+
+    ~CARMASharedInstance()
     {
-      throw std::runtime_error(CarmaErrorCodeToMessage(rc));
+      int rc = 0;
+      InternalDestroyCarma(f_carma_type, &rc);
+      f_carma_type = nullptr;
+      if (rc != 0)
+      {
+        std::cerr << CarmaErrorCodeToMessage(rc) << std::endl;
+      }
+      CARMA::FreeCCompatible(c_parameters);
+      c_parameters = nullptr;
     }
-  }
+  };
 
-  CARMA::~CARMA()
+  namespace
   {
-    int rc = 0;
-    FreeCCompatible(c_carma_parameters_);
-    InternalDestroyCarma(f_carma_type_, &rc);
-    f_carma_type_ = nullptr;  // Clear the pointer to avoid dangling pointer
-    if (rc != 0)
+    /// @brief Measures the aligned regions of a single C-compatible parameter allocation
+    class ParameterBlobLayout
+    {
+     public:
+      /// @brief Reserves space for an array of objects
+      /// @return The offset of the array from the start of the allocation
+      template<typename T>
+      std::size_t Reserve(std::size_t count)
+      {
+        size_ = (size_ + alignof(T) - 1) / alignof(T) * alignof(T);
+        std::size_t const offset = size_;
+        size_ += count * sizeof(T);
+        return offset;
+      }
+
+      std::size_t Size() const
+      {
+        return size_;
+      }
+
+     private:
+      std::size_t size_ = 0;
+    };
+
+    /// @brief A single allocation that C-compatible parameter arrays are placed into in order
+    class ParameterBlob
+    {
+     public:
+      explicit ParameterBlob(std::size_t size)
+          : data_(static_cast<char*>(::operator new(size)))
+      {
+      }
+
+      ~ParameterBlob()
+      {
+        ::operator delete(static_cast<void*>(data_));
+      }
+
+      ParameterBlob(const ParameterBlob&) = delete;
+      ParameterBlob& operator=(const ParameterBlob&) = delete;
+
+      /// @brief Places the next array of zero-initialized objects in the allocation
+      /// @return A pointer to the first object, or nullptr for an empty array
+      template<typename T>
+      T* Place(std::size_t count)
+      {
+        T* first = reinterpret_cast<T*>(data_ + layout_.Reserve<T>(count));
+        if (count == 0)
+        {
+          return nullptr;
+        }
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          new (first + i) T{};
+        }
+        return first;
+      }
+
+      /// @brief Hands ownership of the allocation to the caller
+      void Release()
+      {
+        data_ = nullptr;
+      }
+
+     private:
+      char* data_;
+      ParameterBlobLayout layout_;
+    };
+
+    std::size_t RefractiveIndexCount(const std::vector<std::vector<CARMAComplex>>& refidx)
+    {
+      return refidx.empty() ? 0 : refidx.size() * refidx[0].size();
+    }
+
+    void CopyRefractiveIndices(
+        const std::vector<std::vector<CARMAComplex>>& refidx,
+        CARMAComplexC* c_refidx,
+        int& dim_1_size,
+        int& dim_2_size)
+    {
+      dim_1_size = static_cast<int>(refidx.size());
+      dim_2_size = refidx.empty() ? 0 : static_cast<int>(refidx[0].size());
+      for (int j = 0; j < dim_1_size; ++j)
+      {
+        for (int k = 0; k < dim_2_size; ++k)
+        {
+          c_refidx[j * dim_2_size + k].real = refidx[j][k].real;
+          c_refidx[j * dim_2_size + k].imaginary = refidx[j][k].imaginary;
+        }
+      }
+    }
+
+    template<typename T>
+    void CopyName(const std::string& name, const std::string& shortname, T& c_config)
+    {
+      c_config.name_length = std::min(static_cast<int>(name.length()), 255);
+      std::strncpy(c_config.name, name.c_str(), 255);
+      c_config.name[255] = '\0';
+
+      c_config.shortname_length = std::min(static_cast<int>(shortname.length()), 6);
+      std::strncpy(c_config.shortname, shortname.c_str(), 6);
+      c_config.shortname[6] = '\0';
+    }
+
+    /// @brief A cache entry for one CARMA configuration
+    ///        The entry mutex is held while the configuration is initialized, so concurrent
+    ///        construction initializes each configuration once without blocking other configurations.
+    struct SharedInstanceEntry
+    {
+      CARMAParameters parameters;
+      std::mutex mutex;
+      std::weak_ptr<CARMASharedInstance> instance;
+    };
+
+    // Initialized CARMA instances, matched by parameter equality (the defaulted comparisons of the
+    // parameter structs cover every field). Entries do not keep their instances alive; an instance
+    // is destroyed with the last CARMA object using it. The cache mutex only guards the entry list.
+    std::mutex instance_cache_mutex;
+    std::vector<std::shared_ptr<SharedInstanceEntry>> instance_cache;
+
+    /// @brief Removes entries whose instances have been destroyed and that no thread is initializing
+    void RemoveExpiredInstances()
     {
-      std::cerr << CarmaErrorCodeToMessage(rc) << std::endl;
+      std::erase_if(
+          instance_cache,
+          [](const std::shared_ptr<SharedInstanceEntry>& entry)
+          { return entry.use_count() == 1 && entry->instance.expired(); });
+    }
+
+    std::shared_ptr<CARMASharedInstance> GetSharedInstance(const CARMAParameters& params)
+    {
+      std::shared_ptr<SharedInstanceEntry> entry;
+      {
+        std::lock_guard<std::mutex> cache_lock(instance_cache_mutex);
+        RemoveExpiredInstances();
+        auto cached = std::find_if(
+            instance_cache.begin(),
+            instance_cache.end(),
+            [&params](const std::shared_ptr<SharedInstanceEntry>& candidate) { return candidate->parameters == params; });
+        if (cached != instance_cache.end())
+        {
+          entry = *cached;
+        }
+        else
+        {
+          entry = std::make_shared<SharedInstanceEntry>();
+          entry->parameters = params;
+          instance_cache.push_back(entry);
+        }
+      }
+
+      std::lock_guard<std::mutex> entry_lock(entry->mutex);
+      if (auto instance = entry->instance.lock())
+      {
+        return instance;
+      }
+      auto instance = std::make_shared<CARMASharedInstance>();
+      instance->c_parameters = CARMA::ToCCompatible(params);
+      int rc = 0;
+      instance->f_carma_type = InternalCreateCarma(*instance->c_parameters, &rc);
+      if (rc != 0)
+      {
+        // a partially created Fortran instance is not destroyed, matching the non-cached behavior
+        instance->f_carma_type = nullptr;
+        throw std::runtime_error(CarmaErrorCodeToMessage(rc));
+      }
+      entry->instance = instance;
+      return instance;
     }
+  }  // namespace
+
+  CARMA::CARMA(const CARMAParameters& params)
+      : carma_parameters_(params),
+        shared_instance_(GetSharedInstance(params)),
+        c_carma_parameters_(shared_instance_->c_parameters),
+        f_carma_type_(shared_instance_->f_carma_type)
+  {
+  }
+
+  CARMA::~CARMA()
+  {
+    // the Fortran instance is destroyed with the last CARMA object that shares it
+    c_carma_parameters_ = nullptr;
+    f_carma_type_ = nullptr;
+  }
+
+  std::size_t CARMA::NumberOfCachedInstances()
+  {
+    std::lock_guard<std::mutex> lock(instance_cache_mutex);
+    RemoveExpiredInstances();
+    return static_cast<std::size_t>(std::count_if(
+        instance_cache.begin(),
+        instance_cache.end(),
+        [](const std::shared_ptr<SharedInstanceEntry>& entry) { return !entry->instance.expired(); }));
   }
 
   std::string CARMA::GetVersion()
@@ -143,331 +340,203 @@ namespace musica
 
   CCARMAParameters* CARMA::ToCCompatible(const CARMAParameters& params)
   {
-    CCARMAParameters* c_params = new CCARMAParameters();
+    // Size the single allocation. The regions are reserved in the same order they are filled below.
+    ParameterBlobLayout layout;
+    layout.Reserve<CCARMAParameters>(1);
+    layout.Reserve<CARMAWavelengthBinC>(params.wavelength_bins.size());
+    layout.Reserve<CARMAGroupConfigC>(params.groups.size());
+    for (const auto& group : params.groups)
+    {
+      layout.Reserve<double>(group.df.size());
+    }
+    layout.Reserve<CARMAElementConfigC>(params.elements.size());
+    for (const auto& element : params.elements)
+    {
+      layout.Reserve<double>(element.rhobin.size());
+      layout.Reserve<double>(element.arat.size());
+      layout.Reserve<CARMAComplexC>(RefractiveIndexCount(element.refidx));
+    }
+    layout.Reserve<CARMASoluteConfigC>(params.solutes.size());
+    layout.Reserve<CARMAGasConfigC>(params.gases.size());
+    for (const auto& gas : params.gases)
+    {
+      layout.Reserve<CARMAComplexC>(RefractiveIndexCount(gas.refidx));
+    }
+    layout.Reserve<CARMACoagulationConfigC>(params.coagulations.size());
+    layout.Reserve<CARMAGrowthConfigC>(params.growths.size());
+    layout.Reserve<CARMANucleationConfigC>(params.nucleations.size());
+
+    ParameterBlob blob(layout.Size());
+    CCARMAParameters* c_params = blob.Place<CCARMAParameters>(1);
 
     // Copy simple scalar values
     c_params->nbin = params.nbin;
     c_params->dtime = params.dtime;
-    c_params->nz = params.nz;  // Add nz parameter
+    c_params->nz = params.nz;
 
     // Handle wavelength grid
-    if (!params.wavelength_bins.empty())
+    c_params->wavelength_bin_size = static_cast<int>(params.wavelength_bins.size());
+    c_params->wavelength_bins = blob.Place<CARMAWavelengthBinC>(params.wavelength_bins.size());
+    for (int i = 0; i < c_params->wavelength_bin_size; ++i)
     {
-      c_params->wavelength_bin_size = static_cast<int>(params.wavelength_bins.size());
-      c_params->wavelength_bins = new CARMAWavelengthBinC[c_params->wavelength_bin_size];
-      for (int i = 0; i < c_params->wavelength_bin_size; ++i)
-      {
-        c_params->wavelength_bins[i].center = params.wavelength_bins[i].center;
-        c_params->wavelength_bins[i].width = params.wavelength_bins[i].width;
-        c_params->wavelength_bins[i].do_emission = params.wavelength_bins[i].do_emission;
-      }
-    }
-    else
-    {
-      c_params->wavelength_bins = nullptr;
-      c_params->wavelength_bin_size = 0;
+      c_params->wavelength_bins[i].center = params.wavelength_bins[i].center;
+      c_params->wavelength_bins[i].width = params.wavelength_bins[i].width;
+      c_params->wavelength_bins[i].do_emission = params.wavelength_bins[i].do_emission;
     }
 
     // Handle number of refractive indices
     c_params->number_of_refractive_indices = params.number_of_refractive_indices;
 
     // Handle groups array
-    if (!params.groups.empty())
-    {
-      c_params->groups_size = static_cast<int>(params.groups.size());
-      c_params->groups = new CARMAGroupConfigC[c_params->groups_size];
-
-      for (int i = 0; i < c_params->groups_size; ++i)
-      {
-        const auto& group = params.groups[i];
-        auto& c_group = c_params->groups[i];
-
-        c_group.name_length = std::min(static_cast<int>(group.name.length()), 255);
-        std::strncpy(c_group.name, group.name.c_str(), 255);
-        c_group.name[255] = '\0';
-
-        c_group.shortname_length = std::min(static_cast<int>(group.shortname.length()), 6);
-        std::strncpy(c_group.shortname, group.shortname.c_str(), 6);
-        c_group.shortname[6] = '\0';
-
-        c_group.rmin = group.rmin;
-        c_group.rmrat = group.rmrat;
-        c_group.rmassmin = group.rmassmin;
-        c_group.ishape = static_cast<int>(group.ishape);
-        c_group.eshape = group.eshape;
-        c_group.swelling_algorithm = static_cast<int>(group.swelling_approach.algorithm);
-        c_group.swelling_composition = static_cast<int>(group.swelling_approach.composition);
-        c_group.fall_velocity_routine = static_cast<int>(group.fall_velocity_routine);
-        c_group.mie_calculation_algorithm = static_cast<int>(group.mie_calculation_algorithm);
-        c_group.optics_algorithm = static_cast<int>(group.optics_algorithm);
-        c_group.is_ice = group.is_ice;
-        c_group.is_fractal = group.is_fractal;
-        c_group.is_cloud = group.is_cloud;
-        c_group.is_sulfate = group.is_sulfate;
-        c_group.do_wetdep = group.do_wetdep;
-        c_group.do_drydep = group.do_drydep;
-        c_group.do_vtran = group.do_vtran;
-        c_group.solfac = group.solfac;
-        c_group.scavcoef = group.scavcoef;
-        c_group.dpc_threshold = group.dpc_threshold;
-        c_group.rmon = group.rmon;
-        c_group.falpha = group.falpha;
-        c_group.neutral_volfrc = group.neutral_volfrc;
-
-        // Handle df array
-        if (!group.df.empty())
-        {
-          c_group.df_size = static_cast<int>(group.df.size());
-          c_group.df = new double[c_group.df_size];
-          std::memcpy(c_group.df, group.df.data(), c_group.df_size * sizeof(double));
-        }
-        else
-        {
-          c_group.df = nullptr;
-          c_group.df_size = 0;
-        }
-      }
-    }
-    else
+    c_params->groups_size = static_cast<int>(params.groups.size());
+    c_params->groups = blob.Place<CARMAGroupConfigC>(params.groups.size());
+    for (int i = 0; i < c_params->groups_size; ++i)
     {
-      c_params->groups = nullptr;
-      c_params->groups_size = 0;
+      const auto& group = params.groups[i];
+      auto& c_group = c_params->groups[i];
+
+      CopyName(group.name, group.shortname, c_group);
+
+      c_group.rmin = group.rmin;
+      c_group.rmrat = group.rmrat;
+      c_group.rmassmin = group.rmassmin;
+      c_group.ishape = static_cast<int>(group.ishape);
+      c_group.eshape = group.eshape;
+      c_group.swelling_algorithm = static_cast<int>(group.swelling_approach.algorithm);
+      c_group.swelling_composition = static_cast<int>(group.swelling_approach.composition);
+      c_group.fall_velocity_routine = static_cast<int>(group.fall_velocity_routine);
+      c_group.mie_calculation_algorithm = static_cast<int>(group.mie_calculation_algorithm);
+      c_group.optics_algorithm = static_cast<int>(group.optics_algorithm);
+      c_group.is_ice = group.is_ice;
+      c_group.is_fractal = group.is_fractal;
+      c_group.is_cloud = group.is_cloud;
+      c_group.is_sulfate = group.is_sulfate;
+      c_group.do_wetdep = group.do_wetdep;
+      c_group.do_drydep = group.do_drydep;
+      c_group.do_vtran = group.do_vtran;
+      c_group.solfac = group.solfac;
+      c_group.scavcoef = group.scavcoef;
+      c_group.dpc_threshold = group.dpc_threshold;
+      c_group.rmon = group.rmon;
+      c_group.falpha = group.falpha;
+      c_group.neutral_volfrc = group.neutral_volfrc;
+
+      // Handle df array
+      c_group.df_size = static_cast<int>(group.df.size());
+      c_group.df = blob.Place<double>(group.df.size());
+      std::copy(group.df.begin(), group.df.end(), c_group.df);
     }
 
     // Handle elements array
-    if (!params.elements.empty())
+    c_params->elements_size = static_cast<int>(params.elements.size());
+    c_params->elements = blob.Place<CARMAElementConfigC>(params.elements.size());
+    for (int i = 0; i < c_params->elements_size; ++i)
     {
-      c_params->elements_size = static_cast<int>(params.elements.size());
-      c_params->elements = new CARMAElementConfigC[c_params->elements_size];
+      const auto& element = params.elements[i];
+      auto& c_element = c_params->elements[i];
 
-      for (int i = 0; i < c_params->elements_size; ++i)
-      {
-        const auto& element = params.elements[i];
-        auto& c_element = c_params->elements[i];
-
-        c_element.igroup = element.igroup;
-        c_element.isolute = element.isolute;
+      c_element.igroup = element.igroup;
+      c_element.isolute = element.isolute;
 
-        c_element.name_length = std::min(static_cast<int>(element.name.length()), 255);
-        std::strncpy(c_element.name, element.name.c_str(), 255);
-        c_element.name[255] = '\0';
+      CopyName(element.name, element.shortname, c_element);
 
-        c_element.shortname_length = std::min(static_cast<int>(element.shortname.length()), 6);
-        std::strncpy(c_element.shortname, element.shortname.c_str(), 6);
-        c_element.shortname[6] = '\0';
+      c_element.itype = static_cast<int>(element.itype);
+      c_element.icomposition = static_cast<int>(element.icomposition);
+      c_element.isShell = element.isShell;
+      c_element.rho = element.rho;
+      c_element.kappa = element.kappa;
 
-        c_element.itype = static_cast<int>(element.itype);
-        c_element.icomposition = static_cast<int>(element.icomposition);
-        c_element.isShell = element.isShell;
-        c_element.rho = element.rho;
-        c_element.kappa = element.kappa;
+      // Handle rhobin array
+      c_element.rhobin_size = static_cast<int>(element.rhobin.size());
+      c_element.rhobin = blob.Place<double>(element.rhobin.size());
+      std::copy(element.rhobin.begin(), element.rhobin.end(), c_element.rhobin);
 
-        // Handle rhobin array
-        if (!element.rhobin.empty())
-        {
-          c_element.rhobin_size = static_cast<int>(element.rhobin.size());
-          c_element.rhobin = new double[c_element.rhobin_size];
-          std::memcpy(c_element.rhobin, element.rhobin.data(), c_element.rhobin_size * sizeof(double));
-        }
-        else
-        {
-          c_element.rhobin = nullptr;
-          c_element.rhobin_size = 0;
-        }
-
-        // Handle arat array
-        if (!element.arat.empty())
-        {
-          c_element.arat_size = static_cast<int>(element.arat.size());
-          c_element.arat = new double[c_element.arat_size];
-          std::memcpy(c_element.arat, element.arat.data(), c_element.arat_size * sizeof(double));
-        }
-        else
-        {
-          c_element.arat = nullptr;
-          c_element.arat_size = 0;
-        }
+      // Handle arat array
+      c_element.arat_size = static_cast<int>(element.arat.size());
+      c_element.arat = blob.Place<double>(element.arat.size());
+      std::copy(element.arat.begin(), element.arat.end(), c_element.arat);
 
-        // Handle refractive indices
-        if (!element.refidx.empty())
-        {
-          c_element.refidx_dim_1_size = static_cast<int>(element.refidx.size());
-          c_element.refidx_dim_2_size = static_cast<int>(element.refidx[0].size());
-          c_element.refidx = new CARMAComplexC[c_element.refidx_dim_1_size * c_element.refidx_dim_2_size];
-          for (int j = 0; j < c_element.refidx_dim_1_size; ++j)
-          {
-            for (int k = 0; k < c_element.refidx_dim_2_size; ++k)
-            {
-              c_element.refidx[j * c_element.refidx_dim_2_size + k].real = element.refidx[j][k].real;
-              c_element.refidx[j * c_element.refidx_dim_2_size + k].imaginary = element.refidx[j][k].imaginary;
-            }
-          }
-        }
-        else
-        {
-          c_element.refidx = nullptr;
-          c_element.refidx_dim_1_size = 0;
-          c_element.refidx_dim_2_size = 0;
-        }
-      }
-    }
-    else
-    {
-      c_params->elements = nullptr;
-      c_params->elements_size = 0;
+      // Handle refractive indices
+      c_element.refidx = blob.Place<CARMAComplexC>(RefractiveIndexCount(element.refidx));
+      CopyRefractiveIndices(element.refidx, c_element.refidx, c_element.refidx_dim_1_size, c_element.refidx_dim_2_size);
     }
 
     // Handle solutes array
-    if (!params.solutes.empty())
+    c_params->solutes_size = static_cast<int>(params.solutes.size());
+    c_params->solutes = blob.Place<CARMASoluteConfigC>(params.solutes.size());
+    for (int i = 0; i < c_params->solutes_size; ++i)
     {
-      c_params->solutes_size = static_cast<int>(params.solutes.size());
-      c_params->solutes = new CARMASoluteConfigC[c_params->solutes_size];
-
-      for (int i = 0; i < c_params->solutes_size; ++i)
-      {
-        const auto& solute = params.solutes[i];
-        auto& c_solute = c_params->solutes[i];
+      const auto& solute = params.solutes[i];
+      auto& c_solute = c_params->solutes[i];
 
-        c_solute.name_length = std::min(static_cast<int>(solute.name.length()), 255);
-        std::strncpy(c_solute.name, solute.name.c_str(), c_solute.name_length);
-        c_solute.name[c_solute.name_length] = '\0';
+      CopyName(solute.name, solute.shortname, c_solute);
 
-        c_solute.shortname_length = std::min(static_cast<int>(solute.shortname.length()), 6);
-        std::strncpy(c_solute.shortname, solute.shortname.c_str(), 6);
-        c_solute.shortname[6] = '\0';
-
-        c_solute.ions = solute.ions;
-        c_solute.wtmol = solute.wtmol;
-        c_solute.rho = solute.rho;
-      }
-    }
-    else
-    {
-      c_params->solutes = nullptr;
-      c_params->solutes_size = 0;
+      c_solute.ions = solute.ions;
+      c_solute.wtmol = solute.wtmol;
+      c_solute.rho = solute.rho;
     }
 
     // Handle gases array
-    if (!params.gases.empty())
+    c_params->gases_size = static_cast<int>(params.gases.size());
+    c_params->gases = blob.Place<CARMAGasConfigC>(params.gases.size());
+    for (int i = 0; i < c_params->gases_size; ++i)
     {
-      c_params->gases_size = static_cast<int>(params.gases.size());
-      c_params->gases = new CARMAGasConfigC[c_params->gases_size];
-
-      for (int i = 0; i < c_params->gases_size; ++i)
-      {
-        const auto& gas = params.gases[i];
-        auto& c_gas = c_params->gases[i];
+      const auto& gas = params.gases[i];
+      auto& c_gas = c_params->gases[i];
 
-        c_gas.name_length = std::min(static_cast<int>(gas.name.length()), 255);
-        std::strncpy(c_gas.name, gas.name.c_str(), 255);
-        c_gas.name[255] = '\0';
+      CopyName(gas.name, gas.shortname, c_gas);
 
-        c_gas.shortname_length = std::min(static_cast<int>(gas.shortname.length()), 6);
-        std::strncpy(c_gas.shortname, gas.shortname.c_str(), 6);
-        c_gas.shortname[6] = '\0';
+      c_gas.wtmol = gas.wtmol;
+      c_gas.ivaprtn = static_cast<int>(gas.ivaprtn);
+      c_gas.icomposition = static_cast<int>(gas.icomposition);
+      c_gas.dgc_threshold = gas.dgc_threshold;
+      c_gas.ds_threshold = gas.ds_threshold;
 
-        c_gas.wtmol = gas.wtmol;
-        c_gas.ivaprtn = static_cast<int>(gas.ivaprtn);
-        c_gas.icomposition = static_cast<int>(gas.icomposition);
-        c_gas.dgc_threshold = gas.dgc_threshold;
-        c_gas.ds_threshold = gas.ds_threshold;
-
-        // Handle refractive indices
-        if (!gas.refidx.empty())
-        {
-          c_gas.refidx_dim_1_size = static_cast<int>(gas.refidx.size());
-          c_gas.refidx_dim_2_size = static_cast<int>(gas.refidx[0].size());
-          c_gas.refidx = new CARMAComplexC[c_gas.refidx_dim_1_size * c_gas.refidx_dim_2_size];
-          for (int j = 0; j < c_gas.refidx_dim_1_size; ++j)
-          {
-            for (int k = 0; k < c_gas.refidx_dim_2_size; ++k)
-            {
-              c_gas.refidx[j * c_gas.refidx_dim_2_size + k].real = gas.refidx[j][k].real;
-              c_gas.refidx[j * c_gas.refidx_dim_2_size + k].imaginary = gas.refidx[j][k].imaginary;
-            }
-          }
-        }
-        else
-        {
-          c_gas.refidx = nullptr;
-          c_gas.refidx_dim_1_size = 0;
-          c_gas.refidx_dim_2_size = 0;
-        }
-      }
-    }
-    else
-    {
-      c_params->gases = nullptr;
-      c_params->gases_size = 0;
+      // Handle refractive indices
+      c_gas.refidx = blob.Place<CARMAComplexC>(RefractiveIndexCount(gas.refidx));
+      CopyRefractiveIndices(gas.refidx, c_gas.refidx, c_gas.refidx_dim_1_size, c_gas.refidx_dim_2_size);
     }
 
     // Handle coagulations array
-    if (!params.coagulations.empty())
-    {
-      c_params->coagulations_size = static_cast<int>(params.coagulations.size());
-      c_params->coagulations = new CARMACoagulationConfigC[c_params->coagulations_size];
-      for (int i = 0; i < c_params->coagulations_size; ++i)
-      {
-        const auto& coagulation = params.coagulations[i];
-        auto& c_coagulation = c_params->coagulations[i];
-
-        c_coagulation.igroup1 = coagulation.igroup1;
-        c_coagulation.igroup2 = coagulation.igroup2;
-        c_coagulation.igroup3 = coagulation.igroup3;
-        c_coagulation.algorithm = static_cast<int>(coagulation.algorithm);
-        c_coagulation.ck0 = coagulation.ck0;
-        c_coagulation.grav_e_coll0 = coagulation.grav_e_coll0;
-        c_coagulation.use_ccd = coagulation.use_ccd;
-      }
-    }
-    else
+    c_params->coagulations_size = static_cast<int>(params.coagulations.size());
+    c_params->coagulations = blob.Place<CARMACoagulationConfigC>(params.coagulations.size());
+    for (int i = 0; i < c_params->coagulations_size; ++i)
     {
-      c_params->coagulations = nullptr;
-      c_params->coagulations_size = 0;
+      const auto& coagulation = params.coagulations[i];
+      auto& c_coagulation = c_params->coagulations[i];
+
+      c_coagulation.igroup1 = coagulation.igroup1;
+      c_coagulation.igroup2 = coagulation.igroup2;
+      c_coagulation.igroup3 = coagulation.igroup3;
+      c_coagulation.algorithm = static_cast<int>(coagulation.algorithm);
+      c_coagulation.ck0 = coagulation.ck0;
+      c_coagulation.grav_e_coll0 = coagulation.grav_e_coll0;
+      c_coagulation.use_ccd = coagulation.use_ccd;
     }
 
     // Handle growths array
-    if (!params.growths.empty())
+    c_params->growths_size = static_cast<int>(params.growths.size());
+    c_params->growths = blob.Place<CARMAGrowthConfigC>(params.growths.size());
+    for (int i = 0; i < c_params->growths_size; ++i)
     {
-      c_params->growths_size = static_cast<int>(params.growths.size());
-      c_params->growths = new CARMAGrowthConfigC[c_params->growths_size];
-      for (int i = 0; i < c_params->growths_size; ++i)
-      {
-        const auto& growth = params.growths[i];
-        auto& c_growth = c_params->growths[i];
-
-        c_growth.ielem = growth.ielem;
-        c_growth.igas = growth.igas;
-      }
-    }
-    else
-    {
-      c_params->growths = nullptr;
-      c_params->growths_size = 0;
+      c_params->growths[i].ielem = params.growths[i].ielem;
+      c_params->growths[i].igas = params.growths[i].igas;
     }
 
     // Handle nucleations array
-    if (!params.nucleations.empty())
-    {
-      c_params->nucleations_size = static_cast<int>(params.nucleations.size());
-      c_params->nucleations = new CARMANucleationConfigC[c_params->nucleations_size];
-      for (int i = 0; i < c_params->nucleations_size; ++i)
-      {
-        const auto& nucleation = params.nucleations[i];
-        auto& c_nucleation = c_params->nucleations[i];
-
-        c_nucleation.ielemfrom = nucleation.ielemfrom;
-        c_nucleation.ielemto = nucleation.ielemto;
-        c_nucleation.algorithm = static_cast<int>(nucleation.algorithm);
-        c_nucleation.rlh_nuc = nucleation.rlh_nuc;
-        c_nucleation.igas = nucleation.igas;
-        c_nucleation.ievp2elem = nucleation.ievp2elem;
-      }
-    }
-    else
+    c_params->nucleations_size = static_cast<int>(params.nucleations.size());
+    c_params->nucleations = blob.Place<CARMANucleationConfigC>(params.nucleations.size());
+    for (int i = 0; i < c_params->nucleations_size; ++i)
     {
-      c_params->nucleations = nullptr;
-      c_params->nucleations_size = 0;
+      const auto& nucleation = params.nucleations[i];
+      auto& c_nucleation = c_params->nucleations[i];
+
+      c_nucleation.ielemfrom = nucleation.ielemfrom;
+      c_nucleation.ielemto = nucleation.ielemto;
+      c_nucleation.algorithm = static_cast<int>(nucleation.algorithm);
+      c_nucleation.rlh_nuc = nucleation.rlh_nuc;
+      c_nucleation.igas = nucleation.igas;
+      c_nucleation.ievp2elem = nucleation.ievp2elem;
     }
 
     // Handle initialization configuration
@@ -498,89 +567,14 @@ namespace musica
     c_params->initialization.gstickl = params.initialization.gstickl;
     c_params->initialization.tstick = params.initialization.tstick;
 
+    blob.Release();
     return c_params;
   }
 
   void CARMA::FreeCCompatible(CCARMAParameters* c_params)
   {
-    // Free wavelength bin centers array
-    delete[] c_params->wavelength_bins;
-    c_params->wavelength_bins = nullptr;
-
-    // Free groups array and its nested arrays
-    if (c_params->groups != nullptr)
-    {
-      for (int i = 0; i < c_params->groups_size; ++i)
-      {
-        delete[] c_params->groups[i].df;
-      }
-      delete[] c_params->groups;
-      c_params->groups = nullptr;
-    }
-
-    // Free elements array and its nested arrays
-    if (c_params->elements != nullptr)
-    {
-      for (int i = 0; i < c_params->elements_size; ++i)
-      {
-        delete[] c_params->elements[i].rhobin;
-        delete[] c_params->elements[i].arat;
-      }
-      delete[] c_params->elements;
-      c_params->elements = nullptr;
-    }
-
-    // Free solutes array
-    if (c_params->solutes != nullptr)
-    {
-      delete[] c_params->solutes;
-      c_params->solutes = nullptr;
-    }
-
-    // Free gases array and its nested arrays
-    if (c_params->gases != nullptr)
-    {
-      for (int i = 0; i < c_params->gases_size; ++i)
-      {
-        delete[] c_params->gases[i].refidx;
-      }
-      delete[] c_params->gases;
-      c_params->gases = nullptr;
-    }
-
-    // Free coagulations array
-    if (c_params->coagulations != nullptr)
-    {
-      delete[] c_params->coagulations;
-      c_params->coagulations = nullptr;
-    }
-
-    // Free growths array
-    if (c_params->growths != nullptr)
-    {
-      delete[] c_params->growths;
-      c_params->growths = nullptr;
-    }
-
-    // Free nucleations array
-    if (c_params->nucleations != nullptr)
-    {
-      delete[] c_params->nucleations;
-      c_params->nucleations = nullptr;
-    }
-
-    // Reset sizes
-    c_params->wavelength_bin_size = 0;
-    c_params->groups_size = 0;
-    c_params->elements_size = 0;
-    c_params->solutes_size = 0;
-    c_params->gases_size = 0;
-    c_params->coagulations_size = 0;
-    c_params->growths_size = 0;
-    c_params->nucleations_size = 0;
-
-    // Delete the C-compatible parameters structure itself
-    delete c_params;
+    // All nested arrays live in the same allocation as the parameters structure
+    ::operator delete(static_cast<void*>(c_params));
   }
 
   CARMAParameters CARMA::CreateAluminumTestParams()
@@ -0,0 +1,137 @@
+// Copyright (C) 2023-2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// This file contains the implementation of the CARMA column batch class
+#include <musica/carma/carma.hpp>
+#include <musica/carma/carma_column_batch.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace musica
+{
+
+  CARMAColumnBatch::CARMAColumnBatch(
+      const CARMA& carma,
+      const std::vector<CARMAStateParameters>& column_params,
+      std::size_t number_of_threads)
+  {
+    if (column_params.empty())
+    {
+      throw std::invalid_argument("A CARMA column batch must contain at least one column.");
+    }
+    columns_.reserve(column_params.size());
+    for (const auto& params : column_params)
+    {
+      columns_.push_back(std::make_unique<CARMAState>(carma, params));
+    }
+    if (number_of_threads == 0)
+    {
+      number_of_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    number_of_threads_ = std::min(number_of_threads, columns_.size());
+  }
+
+  CARMAState& CARMAColumnBatch::GetColumn(std::size_t column_index)
+  {
+    if (column_index >= columns_.size())
+    {
+      throw std::out_of_range("Column index " + std::to_string(column_index) + " is out of range.");
+    }
+    return *columns_[column_index];
+  }
+
+  const CARMAState& CARMAColumnBatch::GetColumn(std::size_t column_index) const
+  {
+    if (column_index >= columns_.size())
+    {
+      throw std::out_of_range("Column index " + std::to_string(column_index) + " is out of range.");
+    }
+    return *columns_[column_index];
+  }
+
+  void CARMAColumnBatch::Step(CARMAStateStepConfig& step_config)
+  {
+    // each column gets its own copy so no configuration data is shared between threads
+    std::vector<CARMAStateStepConfig> step_configs(columns_.size(), step_config);
+    Step(step_configs);
+  }
+
+  void CARMAColumnBatch::Step(std::vector<CARMAStateStepConfig>& step_configs)
+  {
+    if (step_configs.size() != columns_.size())
+    {
+      throw std::invalid_argument(
+          "Number of step configurations (" + std::to_string(step_configs.size()) +
+          ") must match the number of columns (" + std::to_string(columns_.size()) + ").");
+    }
+
+    std::exception_ptr first_error;
+    std::mutex error_mutex;
+    auto step_range = [&](std::size_t begin, std::size_t end)
+    {
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        try
+        {
+          columns_[i]->Step(step_configs[i]);
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> lock(error_mutex);
+          if (!first_error)
+          {
+            first_error = std::current_exception();
+          }
+          return;
+        }
+      }
+    };
+
+    if (number_of_threads_ <= 1)
+    {
+      step_range(0, columns_.size());
+    }
+    else
+    {
+      // the calling thread steps the first range of columns
+      std::vector<std::thread> workers;
+      workers.reserve(number_of_threads_ - 1);
+      const std::size_t chunk = columns_.size() / number_of_threads_;
+      const std::size_t remainder = columns_.size() % number_of_threads_;
+      std::size_t begin = chunk + (remainder > 0 ? 1 : 0);
+      for (std::size_t t = 1; t < number_of_threads_; ++t)
+      {
+        const std::size_t end = begin + chunk + (t < remainder ? 1 : 0);
+        workers.emplace_back(step_range, begin, end);
+        begin = end;
+      }
+      step_range(0, chunk + (remainder > 0 ? 1 : 0));
+      for (auto& worker : workers)
+      {
+        worker.join();
+      }
+    }
+
+    if (first_error)
+    {
+      std::rethrow_exception(first_error);
+    }
+  }
+
+  std::vector<CarmaStatistics> CARMAColumnBatch::GetStepStatistics() const
+  {
+    std::vector<CarmaStatistics> statistics;
+    statistics.reserve(columns_.size());
+    for (const auto& column : columns_)
+    {
+      statistics.push_back(column->GetStepStatistics());
+    }
+    return statistics;
+  }
+
+}  // namespace musica
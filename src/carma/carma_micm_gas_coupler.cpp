@@ -0,0 +1,171 @@
+// Copyright (C) 2023-2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// This file contains the implementation of the CARMA-MICM gas coupler
+#include <musica/carma/carma_micm_gas_coupler.hpp>
+#include <musica/micm/micm.hpp>
+#include <musica/micm/state.hpp>
+
+#include <stdexcept>
+#include <string>
+
+namespace musica
+{
+  namespace
+  {
+    std::vector<CARMAMICMGasLink> LinksByComposition(
+        const CARMAParameters& params,
+        const std::map<GasComposition, std::string>& species_by_composition)
+    {
+      std::vector<CARMAMICMGasLink> links;
+      for (const auto& [composition, species] : species_by_composition)
+      {
+        bool found = false;
+        for (const auto& gas : params.gases)
+        {
+          if (gas.icomposition == composition)
+          {
+            links.push_back({ gas.name, species });
+            found = true;
+            break;
+          }
+        }
+        if (!found)
+        {
+          throw std::invalid_argument(
+              "No CARMA gas has the composition (" + std::to_string(static_cast<int>(composition)) +
+              ") linked to MICM species '" + species + "'.");
+        }
+      }
+      return links;
+    }
+  }  // namespace
+
+  CARMAMICMGasCoupler::CARMAMICMGasCoupler(
+      const CARMA& carma,
+      const MICM& micm,
+      const std::vector<CARMAMICMGasLink>& links)
+  {
+    CARMAParameters const params = carma.GetParameters();
+    auto const species_ordering = micm.GetSpeciesOrdering();
+    number_of_species_ = species_ordering.size();
+    vector_size_ = micm.GetVectorSize();
+    nz_ = static_cast<std::size_t>(params.nz);
+    ngas_ = params.gases.size();
+
+    links_.reserve(links.size());
+    for (const auto& link : links)
+    {
+      std::size_t gas_index = 0;
+      while (gas_index < ngas_ && params.gases[gas_index].name != link.carma_gas)
+      {
+        ++gas_index;
+      }
+      if (gas_index == ngas_)
+      {
+        throw std::invalid_argument("CARMA gas '" + link.carma_gas + "' not found.");
+      }
+      if (params.gases[gas_index].wtmol <= 0.0)
+      {
+        throw std::invalid_argument("CARMA gas '" + link.carma_gas + "' must have a positive molecular weight.");
+      }
+      auto species = species_ordering.find(link.micm_species);
+      if (species == species_ordering.end())
+      {
+        throw std::invalid_argument("MICM species '" + link.micm_species + "' not found.");
+      }
+      links_.push_back({ gas_index, species->second, params.gases[gas_index].wtmol });
+    }
+
+    gas_values_.resize(static_cast<std::size_t>(CarmaGasField::NUMBER_OF_FIELDS) * ngas_ * nz_);
+    environmental_values_.resize(static_cast<std::size_t>(CarmaEnvironmentalField::NUMBER_OF_FIELDS) * nz_);
+  }
+
+  CARMAMICMGasCoupler::CARMAMICMGasCoupler(
+      const CARMA& carma,
+      const MICM& micm,
+      const std::map<GasComposition, std::string>& species_by_composition)
+      : CARMAMICMGasCoupler(carma, micm, LinksByComposition(carma.GetParameters(), species_by_composition))
+  {
+  }
+
+  void CARMAMICMGasCoupler::MICMToCARMA(State& micm_state, std::size_t first_grid_cell, CARMAState& carma_state)
+  {
+    LoadCarmaValues(carma_state, micm_state, first_grid_cell);
+
+    const auto& concentrations = micm_state.GetOrderedConcentrations();
+    const double* air_density = environmental_values_.data() +
+                                static_cast<std::size_t>(CarmaEnvironmentalField::AIR_DENSITY) * nz_;
+    double* mass_mixing_ratio =
+        gas_values_.data() + static_cast<std::size_t>(CarmaGasField::MASS_MIXING_RATIO) * ngas_ * nz_;
+    for (const auto& link : links_)
+    {
+      double* gas_mmr = mass_mixing_ratio + link.carma_gas_index * nz_;
+      for (std::size_t k = 0; k < nz_; ++k)
+      {
+        // [mol m-3] * [kg mol-1] / [kg m-3] = [kg kg-1]
+        gas_mmr[k] = concentrations[ConcentrationIndex(first_grid_cell + k, link.micm_species_index)] *
+                     link.molecular_weight / air_density[k];
+      }
+    }
+    carma_state.SetGases(mass_mixing_ratio);
+  }
+
+  void CARMAMICMGasCoupler::CARMAToMICM(const CARMAState& carma_state, State& micm_state, std::size_t first_grid_cell)
+  {
+    LoadCarmaValues(carma_state, micm_state, first_grid_cell);
+
+    auto& concentrations = micm_state.GetOrderedConcentrations();
+    const double* air_density = environmental_values_.data() +
+                                static_cast<std::size_t>(CarmaEnvironmentalField::AIR_DENSITY) * nz_;
+    const double* mass_mixing_ratio =
+        gas_values_.data() + static_cast<std::size_t>(CarmaGasField::MASS_MIXING_RATIO) * ngas_ * nz_;
+    for (const auto& link : links_)
+    {
+      const double* gas_mmr = mass_mixing_ratio + link.carma_gas_index * nz_;
+      for (std::size_t k = 0; k < nz_; ++k)
+      {
+        // [kg kg-1] * [kg m-3] / [kg mol-1] = [mol m-3]
+        concentrations[ConcentrationIndex(first_grid_cell + k, link.micm_species_index)] =
+            gas_mmr[k] * air_density[k] / link.molecular_weight;
+      }
+    }
+  }
+
+  void CARMAMICMGasCoupler::Step(
+      CARMAState& carma_state,
+      CARMAStateStepConfig& step_config,
+      State& micm_state,
+      std::size_t first_grid_cell)
+  {
+    MICMToCARMA(micm_state, first_grid_cell, carma_state);
+    carma_state.Step(step_config);
+    CARMAToMICM(carma_state, micm_state, first_grid_cell);
+  }
+
+  void CARMAMICMGasCoupler::LoadCarmaValues(const CARMAState& carma_state, State& micm_state, std::size_t first_grid_cell)
+  {
+    if (static_cast<std::size_t>(carma_state.GetNumberOfVerticalCenters()) != nz_ ||
+        static_cast<std::size_t>(carma_state.GetNumberOfGases()) != ngas_)
+    {
+      throw std::invalid_argument("CARMA state dimensions do not match the coupled CARMA instance.");
+    }
+    if (first_grid_cell + nz_ > micm_state.NumberOfGridCells())
+    {
+      throw std::out_of_range(
+          "CARMA column starting at grid cell " + std::to_string(first_grid_cell) + " with " + std::to_string(nz_) +
+          " vertical centers does not fit in a MICM state with " + std::to_string(micm_state.NumberOfGridCells()) +
+          " grid cells.");
+    }
+    carma_state.GetGases(gas_values_.data());
+    carma_state.GetEnvironmentalValues(environmental_values_.data());
+  }
+
+  std::size_t CARMAMICMGasCoupler::ConcentrationIndex(std::size_t grid_cell, std::size_t species_index) const
+  {
+    std::size_t const group_index = grid_cell / vector_size_;
+    std::size_t const row_in_group = grid_cell % vector_size_;
+    return (group_index * number_of_species_ + species_index) * vector_size_ + row_in_group;
+  }
+
+}  // namespace musica
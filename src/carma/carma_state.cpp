@@ -7,6 +7,8 @@
 #include <musica/carma/carma_state.hpp>
 #include <musica/carma/error.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <iostream>
 #include <stdexcept>
@@ -14,59 +16,96 @@
 namespace musica
 {
 
+  namespace
+  {
+    /// @brief Validates the state parameters against the CARMA dimensions and wraps them for
+    ///        the Fortran interface. The returned structure points into the data of params.
+    CARMAStateParametersC ToCStateParameters(const CARMAStateParameters& params, int nz, int n_wavelength_bins)
+    {
+      CARMAStateParametersC state_params;
+      state_params.time = params.time;
+      state_params.time_step = params.time_step;
+      state_params.longitude = params.longitude;
+      state_params.latitude = params.latitude;
+      state_params.coordinates = static_cast<int>(params.coordinates);
+      state_params.vertical_center_size = static_cast<int>(params.vertical_center.size());
+      state_params.vertical_center = params.vertical_center.empty() ? nullptr : params.vertical_center.data();
+      if (state_params.vertical_center != nullptr && state_params.vertical_center_size != nz)
+        throw std::invalid_argument("Vertical center heights size must match the number of vertical centers.");
+      state_params.vertical_levels_size = static_cast<int>(params.vertical_levels.size());
+      state_params.vertical_levels = params.vertical_levels.empty() ? nullptr : params.vertical_levels.data();
+      if (state_params.vertical_levels != nullptr && state_params.vertical_levels_size != nz + 1)
+        throw std::invalid_argument("Vertical levels size must match the number of vertical levels.");
+      state_params.temperature_size = static_cast<int>(params.temperature.size());
+      state_params.temperature = params.temperature.empty() ? nullptr : params.temperature.data();
+      if (state_params.temperature != nullptr && state_params.temperature_size != nz)
+        throw std::invalid_argument("Temperature profile size must match the number of vertical centers.");
+      state_params.pressure_size = static_cast<int>(params.pressure.size());
+      state_params.pressure = params.pressure.empty() ? nullptr : params.pressure.data();
+      if (state_params.pressure != nullptr && state_params.pressure_size != nz)
+        throw std::invalid_argument("Pressure profile size must match the number of vertical centers.");
+      state_params.pressure_levels_size = static_cast<int>(params.pressure_levels.size());
+      state_params.pressure_levels = params.pressure_levels.empty() ? nullptr : params.pressure_levels.data();
+      if (state_params.pressure_levels != nullptr && state_params.pressure_levels_size != nz + 1)
+        throw std::invalid_argument("Pressure levels size must match the number of vertical levels.");
+      state_params.specific_humidity_size = static_cast<int>(params.specific_humidity.size());
+      state_params.specific_humidity = params.specific_humidity.empty() ? nullptr : params.specific_humidity.data();
+      if (state_params.specific_humidity != nullptr && state_params.specific_humidity_size != nz)
+        throw std::invalid_argument("Specific humidity profile size must match the number of vertical centers.");
+      state_params.relative_humidity_size = static_cast<int>(params.relative_humidity.size());
+      state_params.relative_humidity = params.relative_humidity.empty() ? nullptr : params.relative_humidity.data();
+      if (state_params.relative_humidity != nullptr && state_params.relative_humidity_size != nz)
+        throw std::invalid_argument("Relative humidity profile size must match the number of vertical centers.");
+      state_params.original_temperature_size = static_cast<int>(params.original_temperature.size());
+      state_params.original_temperature = params.original_temperature.empty() ? nullptr : params.original_temperature.data();
+      if (state_params.original_temperature != nullptr && state_params.original_temperature_size != nz)
+        throw std::invalid_argument("Original temperature profile size must match the number of vertical centers.");
+      state_params.radiative_intensity_dim_1_size = params.radiative_intensity_dim_1_size;
+      state_params.radiative_intensity_dim_2_size = params.radiative_intensity_dim_2_size;
+      state_params.radiative_intensity = params.radiative_intensity.empty() ? nullptr : params.radiative_intensity.data();
+      if (state_params.radiative_intensity != nullptr)
+      {
+        if (state_params.radiative_intensity_dim_1_size != n_wavelength_bins)
+          throw std::invalid_argument("Radiative intensity first dimension size must match the number of wavelength bins.");
+        if (state_params.radiative_intensity_dim_2_size != nz)
+          throw std::invalid_argument(
+              "Radiative intensity second dimension size must match the number of vertical centers.");
+      }
+      return state_params;
+    }
+
+    /// @brief Adds the wall time of a scope to a timer when timing is enabled
+    class ScopedTimer
+    {
+     public:
+      ScopedTimer(bool enabled, double& total)
+          : total_(enabled ? &total : nullptr)
+      {
+        if (total_ != nullptr)
+          start_ = std::chrono::steady_clock::now();
+      }
+
+      ~ScopedTimer()
+      {
+        if (total_ != nullptr)
+          *total_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+      }
+
+     private:
+      double* total_;
+      std::chrono::steady_clock::time_point start_;
+    };
+  }  // namespace
+
   CARMAState::CARMAState(const CARMA& carma, const CARMAStateParameters& params)
+      : carma_(&carma)
   {
     CCARMAParameters* carma_params = carma.GetCParameters();
-    CARMAStateParametersC state_params;
     this->nz = carma_params->nz;
-    int const n_wavelength_bins = carma_params->wavelength_bin_size;
-    state_params.time = params.time;
-    state_params.time_step = params.time_step;
-    state_params.longitude = params.longitude;
-    state_params.latitude = params.latitude;
-    state_params.coordinates = static_cast<int>(params.coordinates);
-    state_params.vertical_center_size = static_cast<int>(params.vertical_center.size());
-    state_params.vertical_center = params.vertical_center.empty() ? nullptr : params.vertical_center.data();
-    if (state_params.vertical_center != nullptr && state_params.vertical_center_size != this->nz)
-      throw std::invalid_argument("Vertical center heights size must match the number of vertical centers.");
-    state_params.vertical_levels_size = static_cast<int>(params.vertical_levels.size());
-    state_params.vertical_levels = params.vertical_levels.empty() ? nullptr : params.vertical_levels.data();
-    if (state_params.vertical_levels != nullptr && state_params.vertical_levels_size != this->nz + 1)
-      throw std::invalid_argument("Vertical levels size must match the number of vertical levels.");
-    state_params.temperature_size = static_cast<int>(params.temperature.size());
-    state_params.temperature = params.temperature.empty() ? nullptr : params.temperature.data();
-    if (state_params.temperature != nullptr && state_params.temperature_size != this->nz)
-      throw std::invalid_argument("Temperature profile size must match the number of vertical centers.");
-    state_params.pressure_size = static_cast<int>(params.pressure.size());
-    state_params.pressure = params.pressure.empty() ? nullptr : params.pressure.data();
-    if (state_params.pressure != nullptr && state_params.pressure_size != this->nz)
-      throw std::invalid_argument("Pressure profile size must match the number of vertical centers.");
-    state_params.pressure_levels_size = static_cast<int>(params.pressure_levels.size());
-    state_params.pressure_levels = params.pressure_levels.empty() ? nullptr : params.pressure_levels.data();
-    if (state_params.pressure_levels != nullptr && state_params.pressure_levels_size != this->nz + 1)
-      throw std::invalid_argument("Pressure levels size must match the number of vertical levels.");
-    state_params.specific_humidity_size = static_cast<int>(params.specific_humidity.size());
-    state_params.specific_humidity = params.specific_humidity.empty() ? nullptr : params.specific_humidity.data();
-    if (state_params.specific_humidity != nullptr && state_params.specific_humidity_size != this->nz)
-      throw std::invalid_argument("Specific humidity profile size must match the number of vertical centers.");
-    state_params.relative_humidity_size = static_cast<int>(params.relative_humidity.size());
-    state_params.relative_humidity = params.relative_humidity.empty() ? nullptr : params.relative_humidity.data();
-    if (state_params.relative_humidity != nullptr && state_params.relative_humidity_size != this->nz)
-      throw std::invalid_argument("Relative humidity profile size must match the number of vertical centers.");
-    state_params.original_temperature_size = static_cast<int>(params.original_temperature.size());
-    state_params.original_temperature = params.original_temperature.empty() ? nullptr : params.original_temperature.data();
-    if (state_params.original_temperature != nullptr && state_params.original_temperature_size != this->nz)
-      throw std::invalid_argument("Original temperature profile size must match the number of vertical centers.");
-    state_params.radiative_intensity_dim_1_size = params.radiative_intensity_dim_1_size;
-    state_params.radiative_intensity_dim_2_size = params.radiative_intensity_dim_2_size;
-    state_params.radiative_intensity = params.radiative_intensity.empty() ? nullptr : params.radiative_intensity.data();
-    if (state_params.radiative_intensity != nullptr)
-    {
-      if (state_params.radiative_intensity_dim_1_size != n_wavelength_bins)
-        throw std::invalid_argument("Radiative intensity first dimension size must match the number of wavelength bins.");
-      if (state_params.radiative_intensity_dim_2_size != this->nz)
-        throw std::invalid_argument("Radiative intensity second dimension size must match the number of vertical centers.");
-    }
+    this->nbin = carma_params->nbin;
+    this->nelem = carma_params->elements_size;
+    this->ngas = carma_params->gases_size;
+    CARMAStateParametersC state_params = ToCStateParameters(params, nz, carma_params->wavelength_bin_size);
 
     int rc;
     f_carma_state_ = InternalCreateCarmaState(
@@ -80,6 +119,24 @@ namespace musica
     }
   }
 
+  void CARMAState::Reset(const CARMAStateParameters& params)
+  {
+    if (f_carma_state_ == nullptr)
+    {
+      throw std::runtime_error("CARMA state instance is not initialized.");
+    }
+
+    CCARMAParameters* carma_params = carma_->GetCParameters();
+    CARMAStateParametersC state_params = ToCStateParameters(params, nz, carma_params->wavelength_bin_size);
+
+    int rc;
+    InternalResetCarmaState(f_carma_state_, carma_->GetCarmaInstance(), *carma_params, state_params, &rc);
+    if (rc != 0)
+    {
+      throw std::runtime_error(CarmaErrorCodeToMessage(rc));
+    }
+  }
+
   CARMAState::~CARMAState()
   {
     if (f_carma_state_ != nullptr)
@@ -101,6 +158,8 @@ namespace musica
       throw std::runtime_error("CARMA state instance is not initialized.");
     }
 
+    ScopedTimer timer(timing_.enabled, timing_.set_time);
+
     if (values.empty())
     {
       throw std::invalid_argument("Values vector cannot be empty.");
@@ -122,6 +181,8 @@ namespace musica
       throw std::runtime_error("CARMA state instance is not initialized.");
     }
 
+    ScopedTimer timer(timing_.enabled, timing_.set_time);
+
     if (values.empty())
     {
       throw std::invalid_argument("Values vector cannot be empty.");
@@ -147,6 +208,8 @@ namespace musica
       throw std::runtime_error("CARMA state instance is not initialized.");
     }
 
+    ScopedTimer timer(timing_.enabled, timing_.set_time);
+
     if (values.empty())
     {
       throw std::invalid_argument("Values vector cannot be empty.");
@@ -171,6 +234,66 @@ namespace musica
     }
   }
 
+  void CARMAState::SetBins(const double* values, const double* surface_mass)
+  {
+    if (f_carma_state_ == nullptr)
+    {
+      throw std::runtime_error("CARMA state instance is not initialized.");
+    }
+
+    ScopedTimer timer(timing_.enabled, timing_.set_time);
+
+    if (values == nullptr || surface_mass == nullptr)
+    {
+      throw std::invalid_argument("Bin values and surface masses cannot be null.");
+    }
+
+    int rc;
+    InternalSetBins(f_carma_state_, nz, nbin, nelem, values, surface_mass, &rc);
+    if (rc != 0)
+    {
+      throw std::runtime_error(CarmaErrorCodeToMessage(rc));
+    }
+  }
+
+  void CARMAState::SetGases(
+      const double* values,
+      const double* old_mmr,
+      const double* gas_saturation_wrt_ice,
+      const double* gas_saturation_wrt_liquid)
+  {
+    if (f_carma_state_ == nullptr)
+    {
+      throw std::runtime_error("CARMA state instance is not initialized.");
+    }
+
+    ScopedTimer timer(timing_.enabled, timing_.set_time);
+
+    if (values == nullptr)
+    {
+      throw std::invalid_argument("Gas values cannot be null.");
+    }
+
+    int const size = nz * ngas;
+    int rc;
+    InternalSetGases(
+        f_carma_state_,
+        nz,
+        ngas,
+        values,
+        old_mmr,
+        old_mmr == nullptr ? 0 : size,
+        gas_saturation_wrt_ice,
+        gas_saturation_wrt_ice == nullptr ? 0 : size,
+        gas_saturation_wrt_liquid,
+        gas_saturation_wrt_liquid == nullptr ? 0 : size,
+        &rc);
+    if (rc != 0)
+    {
+      throw std::runtime_error(CarmaErrorCodeToMessage(rc));
+    }
+  }
+
   void CARMAState::SetTemperature(const std::vector<double>& temperature)
   {
     if (f_carma_state_ == nullptr)
@@ -178,6 +301,8 @@ namespace musica
       throw std::runtime_error("CARMA state instance is not initialized.");
     }
 
+    ScopedTimer timer(timing_.enabled, timing_.set_time);
+
     if (temperature.empty())
     {
       throw std::invalid_argument("Temperature vector cannot be empty.");
@@ -198,6 +323,8 @@ namespace musica
       throw std::runtime_error("CARMA state instance is not initialized.");
     }
 
+    ScopedTimer timer(timing_.enabled, timing_.set_time);
+
     if (air_density.empty())
     {
       throw std::invalid_argument("Air density vector cannot be empty.");
@@ -236,6 +363,7 @@ namespace musica
     {
       throw std::runtime_error(CarmaErrorCodeToMessage(rc));
     }
+    stats.timing = timing_;
     return stats;
   }
 
@@ -246,6 +374,8 @@ namespace musica
       throw std::runtime_error("CARMA state instance is not initialized.");
     }
 
+    ScopedTimer timer(timing_.enabled, timing_.get_time);
+
     CarmaBinValues bin_values;
     bin_values.mass_mixing_ratio.resize(nz);
     bin_values.number_mixing_ratio.resize(nz);
@@ -296,6 +426,8 @@ namespace musica
       throw std::runtime_error("CARMA state instance is not initialized.");
     }
 
+    ScopedTimer timer(timing_.enabled, timing_.get_time);
+
     CarmaDetrainValues detrain_values;
     detrain_values.mass_mixing_ratio.resize(nz);
     detrain_values.number_mixing_ratio.resize(nz);
@@ -330,6 +462,8 @@ namespace musica
     {
       throw std::runtime_error("CARMA state instance is not initialized.");
     }
+
+    ScopedTimer timer(timing_.enabled, timing_.get_time);
     CarmaGasValues gas_values;
     gas_values.mass_mixing_ratio.resize(nz);
     gas_values.gas_saturation_wrt_ice.resize(nz);
@@ -366,6 +500,8 @@ namespace musica
       throw std::runtime_error("CARMA state instance is not initialized.");
     }
 
+    ScopedTimer timer(timing_.enabled, timing_.get_time);
+
     CarmaEnvironmentalValues values;
     values.temperature.resize(nz);
     values.pressure.resize(nz);
@@ -390,6 +526,79 @@ namespace musica
     return values;
   }
 
+  void CARMAState::GetEnvironmentalValues(double* values) const
+  {
+    if (f_carma_state_ == nullptr)
+    {
+      throw std::runtime_error("CARMA state instance is not initialized.");
+    }
+
+    ScopedTimer timer(timing_.enabled, timing_.get_time);
+
+    if (values == nullptr)
+    {
+      throw std::invalid_argument("Environmental output array cannot be null.");
+    }
+
+    int rc;
+    InternalGetEnvironmentalValues(
+        f_carma_state_,
+        nz,
+        values + static_cast<int>(CarmaEnvironmentalField::TEMPERATURE) * nz,
+        values + static_cast<int>(CarmaEnvironmentalField::PRESSURE) * nz,
+        values + static_cast<int>(CarmaEnvironmentalField::AIR_DENSITY) * nz,
+        values + static_cast<int>(CarmaEnvironmentalField::LATENT_HEAT) * nz,
+        &rc);
+    if (rc != 0)
+    {
+      throw std::runtime_error(CarmaErrorCodeToMessage(rc));
+    }
+  }
+
+  void CARMAState::GetBins(double* profiles, double* fall_velocity, double* surface_values) const
+  {
+    if (f_carma_state_ == nullptr)
+    {
+      throw std::runtime_error("CARMA state instance is not initialized.");
+    }
+
+    ScopedTimer timer(timing_.enabled, timing_.get_time);
+
+    if (profiles == nullptr || fall_velocity == nullptr || surface_values == nullptr)
+    {
+      throw std::invalid_argument("Bin output arrays cannot be null.");
+    }
+
+    int rc;
+    InternalGetBins(f_carma_state_, nz, nbin, nelem, profiles, fall_velocity, surface_values, &rc);
+    if (rc != 0)
+    {
+      throw std::runtime_error(CarmaErrorCodeToMessage(rc));
+    }
+  }
+
+  void CARMAState::GetGases(double* values) const
+  {
+    if (f_carma_state_ == nullptr)
+    {
+      throw std::runtime_error("CARMA state instance is not initialized.");
+    }
+
+    ScopedTimer timer(timing_.enabled, timing_.get_time);
+
+    if (values == nullptr)
+    {
+      throw std::invalid_argument("Gas output array cannot be null.");
+    }
+
+    int rc;
+    InternalGetGases(f_carma_state_, nz, ngas, values, &rc);
+    if (rc != 0)
+    {
+      throw std::runtime_error(CarmaErrorCodeToMessage(rc));
+    }
+  }
+
   void CARMAState::Step(CARMAStateStepConfig& step_config)
   {
     if (f_carma_state_ == nullptr)
@@ -414,10 +623,37 @@ namespace musica
     step_config_c.ice.area_fraction = step_config.ice.area_fraction;
 
     int rc;
+    if (!timing_.enabled)
+    {
+      InternalStepCarmaState(f_carma_state_, step_config_c, &rc);
+      if (rc != 0)
+      {
+        throw std::runtime_error(CarmaErrorCodeToMessage(rc));
+      }
+      return;
+    }
+
+    auto const start = std::chrono::steady_clock::now();
     InternalStepCarmaState(f_carma_state_, step_config_c, &rc);
+    double const step_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
     if (rc != 0)
     {
       throw std::runtime_error(CarmaErrorCodeToMessage(rc));
     }
+    timing_.number_of_steps += 1;
+    timing_.step_time += step_time;
+    timing_.max_step_time = std::max(timing_.max_step_time, step_time);
+  }
+
+  void CARMAState::EnableTiming(bool enabled)
+  {
+    timing_.enabled = enabled;
+  }
+
+  void CARMAState::ResetTiming()
+  {
+    bool const enabled = timing_.enabled;
+    timing_ = CarmaTimingStatistics{};
+    timing_.enabled = enabled;
   }
 }  // namespace musica
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <musica/configuration/parse.hpp>
+#include <musica/configuration/reaction_conversion.hpp>
 #include <musica/micm/lambda_callback.hpp>
 #include <musica/utils/error_code.hpp>
 
@@ -10,10 +11,12 @@
 #include <micm/process/rate_constant/lambda_rate_constant.hpp>
 
 #include <sstream>
+#include <utility>
 
 using namespace mechanism_configuration;
 // used to come from mechanism configuration's validation, but that is now a private header
 inline constexpr std::string_view molecular_weight = "molecular weight [kg mol-1]";
+inline constexpr std::string_view density_property = "density [kg m-3]";
 
 namespace musica
 {
@@ -36,6 +39,73 @@ namespace musica
     return (iss >> result >> std::ws).eof() && !value.empty();
   }
 
+  micm::ArrheniusRateConstantParameters ToMicmParameters(const types::Arrhenius& reaction)
+  {
+    micm::ArrheniusRateConstantParameters parameters;
+    parameters.A_ = reaction.A;
+    parameters.B_ = reaction.B;
+    parameters.C_ = reaction.C;
+    parameters.D_ = reaction.D;
+    parameters.E_ = reaction.E;
+    return parameters;
+  }
+
+  micm::TroeRateConstantParameters ToMicmParameters(const types::Troe& reaction)
+  {
+    micm::TroeRateConstantParameters parameters;
+    parameters.k0_A_ = reaction.k0_A;
+    parameters.k0_B_ = reaction.k0_B;
+    parameters.k0_C_ = reaction.k0_C;
+    parameters.kinf_A_ = reaction.kinf_A;
+    parameters.kinf_B_ = reaction.kinf_B;
+    parameters.kinf_C_ = reaction.kinf_C;
+    parameters.Fc_ = reaction.Fc;
+    parameters.N_ = reaction.N;
+    return parameters;
+  }
+
+  micm::TernaryChemicalActivationRateConstantParameters ToMicmParameters(const types::TernaryChemicalActivation& reaction)
+  {
+    micm::TernaryChemicalActivationRateConstantParameters parameters;
+    parameters.k0_A_ = reaction.k0_A;
+    parameters.k0_B_ = reaction.k0_B;
+    parameters.k0_C_ = reaction.k0_C;
+    parameters.kinf_A_ = reaction.kinf_A;
+    parameters.kinf_B_ = reaction.kinf_B;
+    parameters.kinf_C_ = reaction.kinf_C;
+    parameters.Fc_ = reaction.Fc;
+    parameters.N_ = reaction.N;
+    return parameters;
+  }
+
+  micm::TunnelingRateConstantParameters ToMicmParameters(const types::Tunneling& reaction)
+  {
+    micm::TunnelingRateConstantParameters parameters;
+    parameters.A_ = reaction.A;
+    parameters.B_ = reaction.B;
+    parameters.C_ = reaction.C;
+    return parameters;
+  }
+
+  micm::TaylorSeriesRateConstantParameters ToMicmParameters(const types::TaylorSeries& reaction)
+  {
+    micm::TaylorSeriesRateConstantParameters parameters;
+    parameters.A_ = reaction.A;
+    parameters.B_ = reaction.B;
+    parameters.C_ = reaction.C;
+    parameters.D_ = reaction.D;
+    parameters.E_ = reaction.E;
+    if (reaction.taylor_coefficients.size() > micm::TaylorSeriesRateConstantParameters::MAX_COEFFICIENTS)
+    {
+      throw musica::Exception(
+          musica::ParseErrorCode::ParsingFailed,
+          "Number of Taylor series coefficients for reaction '" + reaction.name + "' exceeds the maximum supported (" +
+              std::to_string(micm::TaylorSeriesRateConstantParameters::MAX_COEFFICIENTS) + ").");
+    }
+    std::copy(reaction.taylor_coefficients.begin(), reaction.taylor_coefficients.end(), parameters.coefficients_);
+    return parameters;
+  }
+
   std::vector<micm::Species> convert_species(const std::vector<types::Species>& species)
   {
     using namespace mechanism_configuration;
@@ -50,6 +120,10 @@ namespace musica
       {
         s.SetProperty(std::string(molecular_weight), elem.molecular_weight.value());
       }
+      if (elem.density.has_value())
+      {
+        s.SetProperty(std::string(density_property), elem.density.value());
+      }
       if (elem.constant_concentration.has_value())
       {
         auto constant_concentration = elem.constant_concentration.value();
@@ -119,6 +193,10 @@ namespace musica
         {
           micm_phase_species.SetDiffusionCoefficient(phase_species.diffusion_coefficient.value());
         }
+        if (phase_species.density.has_value())
+        {
+          micm_phase_species.SetDensity(phase_species.density.value());
+        }
         phase_species_list.emplace_back(micm_phase_species);
       }
 
@@ -168,12 +246,7 @@ namespace musica
   {
     for (const auto& reaction : arrhenius)
     {
-      micm::ArrheniusRateConstantParameters parameters;
-      parameters.A_ = reaction.A;
-      parameters.B_ = reaction.B;
-      parameters.C_ = reaction.C;
-      parameters.D_ = reaction.D;
-      parameters.E_ = reaction.E;
+      micm::ArrheniusRateConstantParameters const parameters = ToMicmParameters(reaction);
       auto reactants = reaction_components_to_reactants(reaction.reactants, species_map);
       auto products = reaction_components_to_products(reaction.products, species_map);
       chemistry.processes.push_back(micm::ChemicalReactionBuilder()
@@ -271,15 +344,7 @@ namespace musica
     {
       auto reactants = reaction_components_to_reactants(reaction.reactants, species_map);
       auto products = reaction_components_to_products(reaction.products, species_map);
-      micm::TroeRateConstantParameters parameters;
-      parameters.k0_A_ = reaction.k0_A;
-      parameters.k0_B_ = reaction.k0_B;
-      parameters.k0_C_ = reaction.k0_C;
-      parameters.kinf_A_ = reaction.kinf_A;
-      parameters.kinf_B_ = reaction.kinf_B;
-      parameters.kinf_C_ = reaction.kinf_C;
-      parameters.Fc_ = reaction.Fc;
-      parameters.N_ = reaction.N;
+      micm::TroeRateConstantParameters const parameters = ToMicmParameters(reaction);
       chemistry.processes.push_back(micm::ChemicalReactionBuilder()
                                         .SetReactants(reactants)
                                         .SetProducts(products)
@@ -298,15 +363,7 @@ namespace musica
     {
       auto reactants = reaction_components_to_reactants(reaction.reactants, species_map);
       auto products = reaction_components_to_products(reaction.products, species_map);
-      micm::TernaryChemicalActivationRateConstantParameters parameters;
-      parameters.k0_A_ = reaction.k0_A;
-      parameters.k0_B_ = reaction.k0_B;
-      parameters.k0_C_ = reaction.k0_C;
-      parameters.kinf_A_ = reaction.kinf_A;
-      parameters.kinf_B_ = reaction.kinf_B;
-      parameters.kinf_C_ = reaction.kinf_C;
-      parameters.Fc_ = reaction.Fc;
-      parameters.N_ = reaction.N;
+      micm::TernaryChemicalActivationRateConstantParameters const parameters = ToMicmParameters(reaction);
       chemistry.processes.push_back(micm::ChemicalReactionBuilder()
                                         .SetReactants(reactants)
                                         .SetProducts(products)
@@ -325,10 +382,7 @@ namespace musica
     {
       auto reactants = reaction_components_to_reactants(reaction.reactants, species_map);
       auto products = reaction_components_to_products(reaction.products, species_map);
-      micm::TunnelingRateConstantParameters parameters;
-      parameters.A_ = reaction.A;
-      parameters.B_ = reaction.B;
-      parameters.C_ = reaction.C;
+      micm::TunnelingRateConstantParameters const parameters = ToMicmParameters(reaction);
       chemistry.processes.push_back(micm::ChemicalReactionBuilder()
                                         .SetReactants(reactants)
                                         .SetProducts(products)
@@ -347,20 +401,7 @@ namespace musica
     {
       auto reactants = reaction_components_to_reactants(reaction.reactants, species_map);
       auto products = reaction_components_to_products(reaction.products, species_map);
-      micm::TaylorSeriesRateConstantParameters parameters;
-      parameters.A_ = reaction.A;
-      parameters.B_ = reaction.B;
-      parameters.C_ = reaction.C;
-      parameters.D_ = reaction.D;
-      parameters.E_ = reaction.E;
-      if (reaction.taylor_coefficients.size() > micm::TaylorSeriesRateConstantParameters::MAX_COEFFICIENTS)
-      {
-        throw musica::Exception(
-            musica::ParseErrorCode::ParsingFailed,
-            "Number of Taylor series coefficients for reaction '" + reaction.name + "' exceeds the maximum supported (" +
-                std::to_string(micm::TaylorSeriesRateConstantParameters::MAX_COEFFICIENTS) + ").");
-      }
-      std::copy(reaction.taylor_coefficients.begin(), reaction.taylor_coefficients.end(), parameters.coefficients_);
+      micm::TaylorSeriesRateConstantParameters const parameters = ToMicmParameters(reaction);
       chemistry.processes.push_back(micm::ChemicalReactionBuilder()
                                         .SetReactants(reactants)
                                         .SetProducts(products)
@@ -370,27 +411,6 @@ namespace musica
     }
   }
 
-  // Helper traits to detect the presence of reactants and products members
-  template<typename T, typename = void>
-  struct has_reactants : std::false_type
-  {
-  };
-
-  template<typename T>
-  struct has_reactants<T, std::void_t<decltype(std::declval<T>().reactants)>> : std::true_type
-  {
-  };
-
-  template<typename T, typename = void>
-  struct has_products : std::false_type
-  {
-  };
-
-  template<typename T>
-  struct has_products<T, std::void_t<decltype(std::declval<T>().products)>> : std::true_type
-  {
-  };
-
   void convert_lambda_rate_constants(
       Chemistry& chemistry,
       const std::vector<types::LambdaRateConstant>& reactions,
@@ -454,22 +474,29 @@ namespace musica
   }
 
   Chemistry ConvertChemistry(const Mechanism& mechanism)
+  {
+    ChemistryTables tables;
+    return ConvertChemistry(mechanism, tables);
+  }
+
+  Chemistry ConvertChemistry(const Mechanism& mechanism, ChemistryTables& tables)
   {
     Chemistry chemistry{};
-    auto species = convert_species(mechanism.species);
-    std::unordered_map<std::string, micm::Species> species_map;
-    for (const auto& species : species)
+    auto& species_map = tables.species;
+    species_map.clear();
+    for (auto& species : convert_species(mechanism.species))
     {
-      species_map[species.name_] = species;
+      species_map[species.name_] = std::move(species);
     }
-    auto phases = convert_phases(mechanism.phases, species_map);
+    tables.phases.clear();
     micm::Phase& gas_phase = chemistry.system.gas_phase_;
-    for (const auto& phase : phases)
+    for (auto& phase : convert_phases(mechanism.phases, species_map))
     {
       if (phase.name_ == "gas")
       {
         gas_phase = phase;
       }
+      tables.phases[phase.name_] = std::move(phase);
     }
     convert_arrhenius(chemistry, mechanism.reactions.arrhenius, species_map);
     convert_branched(chemistry, mechanism.reactions.branched, species_map);
@@ -0,0 +1,425 @@
+// Copyright (C) 2023-2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Directed relation graph (DRG) reduction of a parsed mechanism. See
+// Lu & Law (2005), "A directed relation graph method for mechanism reduction".
+#include <musica/configuration/parse.hpp>
+#include <musica/configuration/reaction_conversion.hpp>
+#include <musica/configuration/reduce.hpp>
+#include <musica/utils/error_code.hpp>
+
+#include <mechanism_configuration/types/reactions.hpp>
+#include <mechanism_configuration/types/species.hpp>
+#include <micm/process/rate_constant/rate_constant_functions.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
+
+namespace musica
+{
+  namespace
+  {
+    namespace types = mechanism_configuration::types;
+
+    /// @brief A species index and its stoichiometric coefficient in a reaction
+    using Component = std::pair<std::size_t, double>;
+
+    /// @brief Reaction view shared by every reaction type
+    struct ReactionEntry
+    {
+      std::vector<Component> reactants;
+      std::vector<Component> products;
+      std::function<std::optional<double>(const ReductionConditions&)> rate_constant;
+    };
+
+    void AppendComponents(
+        const std::vector<types::ReactionComponent>& components,
+        const std::unordered_map<std::string, std::size_t>& species_index,
+        std::vector<Component>& out)
+    {
+      for (const auto& component : components)
+      {
+        auto it = species_index.find(component.name);
+        if (it == species_index.end())
+        {
+          throw musica::Exception(
+              musica::MicmErrorCode::SpeciesNotFound, "Species '" + component.name + "' used in a reaction is not defined");
+        }
+        out.emplace_back(it->second, component.coefficient);
+      }
+    }
+
+    void AppendComponents(
+        const types::ReactionComponent& component,
+        const std::unordered_map<std::string, std::size_t>& species_index,
+        std::vector<Component>& out)
+    {
+      AppendComponents(std::vector<types::ReactionComponent>{ component }, species_index, out);
+    }
+
+    std::optional<double> HostRateParameter(const ReductionConditions& conditions, const std::string& label)
+    {
+      auto it = conditions.rate_parameters.find(label);
+      if (it == conditions.rate_parameters.end())
+        return std::nullopt;
+      return it->second;
+    }
+
+    // Rate constants that MICM calculates from the conditions alone are evaluated with MICM's own
+    // rate constant functions, from the same parameters ConvertChemistry builds, so the reduction
+    // and the solver always agree. The remaining types are supplied by the host as rate parameters.
+    template<typename T>
+    std::optional<double> EvaluateRateConstant(const T& reaction, const std::string& prefix, const ReductionConditions& c)
+    {
+      if constexpr (std::is_same_v<T, types::Arrhenius>)
+      {
+        return micm::CalculateArrhenius(ToMicmParameters(reaction), c.temperature, c.pressure);
+      }
+      else if constexpr (std::is_same_v<T, types::TaylorSeries>)
+      {
+        return micm::CalculateTaylorSeries(ToMicmParameters(reaction), c.temperature, c.pressure);
+      }
+      else if constexpr (std::is_same_v<T, types::Troe>)
+      {
+        return micm::CalculateTroe(ToMicmParameters(reaction), c.temperature, c.air_density);
+      }
+      else if constexpr (std::is_same_v<T, types::TernaryChemicalActivation>)
+      {
+        return micm::CalculateTernaryChemicalActivation(ToMicmParameters(reaction), c.temperature, c.air_density);
+      }
+      else if constexpr (std::is_same_v<T, types::Tunneling>)
+      {
+        return micm::CalculateTunneling(ToMicmParameters(reaction), c.temperature);
+      }
+      else if constexpr (std::is_same_v<T, types::Branched>)
+      {
+        // The branching ratio depends on MICM internals; keep these reactions unconditionally
+        return std::nullopt;
+      }
+      else if constexpr (std::is_same_v<T, types::Surface>)
+      {
+        // MICM calculates surface rate constants from the aerosol effective radius and number
+        // concentration ("SURF.<name>.effective radius [m]" and "SURF.<name>.particle number
+        // concentration [# m-3]") and the gas-phase diffusion of the reacting species, none of
+        // which are sampled here; keep these reactions unconditionally
+        return std::nullopt;
+      }
+      else
+      {
+        auto value = HostRateParameter(c, prefix + reaction.name);
+        if constexpr (has_scaling_factor<T>::value)
+        {
+          if (value.has_value())
+            return value.value() * reaction.scaling_factor;
+        }
+        return value;
+      }
+    }
+
+    template<typename T>
+    ReactionEntry MakeEntry(
+        const T& reaction,
+        const std::string& prefix,
+        const std::unordered_map<std::string, std::size_t>& species_index)
+    {
+      ReactionEntry entry;
+      if constexpr (std::is_same_v<T, types::Surface>)
+      {
+        AppendComponents(reaction.gas_phase_species, species_index, entry.reactants);
+        AppendComponents(reaction.gas_phase_products, species_index, entry.products);
+      }
+      else if constexpr (std::is_same_v<T, types::Branched>)
+      {
+        AppendComponents(reaction.reactants, species_index, entry.reactants);
+        AppendComponents(reaction.alkoxy_products, species_index, entry.products);
+        AppendComponents(reaction.nitrate_products, species_index, entry.products);
+      }
+      else
+      {
+        if constexpr (has_reactants<T>::value)
+          AppendComponents(reaction.reactants, species_index, entry.reactants);
+        if constexpr (has_products<T>::value)
+          AppendComponents(reaction.products, species_index, entry.products);
+      }
+      entry.rate_constant = [reaction, prefix](const ReductionConditions& c)
+      { return EvaluateRateConstant(reaction, prefix, c); };
+      return entry;
+    }
+
+    /// @brief Calls f(list, label prefix) for every reaction list, in the order used by ConvertChemistry
+    template<typename Reactions, typename F>
+    void ForEachReactionList(Reactions& reactions, F&& f)
+    {
+      f(reactions.arrhenius, "");
+      f(reactions.branched, "");
+      f(reactions.surface, "SURF.");
+      f(reactions.taylor_series, "");
+      f(reactions.troe, "");
+      f(reactions.ternary_chemical_activation, "");
+      f(reactions.tunneling, "");
+      f(reactions.photolysis, "PHOTO.");
+      f(reactions.emission, "EMIS.");
+      f(reactions.first_order_loss, "LOSS.");
+      f(reactions.user_defined, "USER.");
+      f(reactions.lambda_rate_constant, "Lambda.");
+    }
+
+    /// @brief Net stoichiometric coefficient of every species in a reaction
+    std::unordered_map<std::size_t, double> NetStoichiometry(const ReactionEntry& reaction)
+    {
+      std::unordered_map<std::size_t, double> net;
+      for (const auto& [index, coefficient] : reaction.reactants)
+        net[index] -= coefficient;
+      for (const auto& [index, coefficient] : reaction.products)
+        net[index] += coefficient;
+      return net;
+    }
+
+  }  // namespace
+
+  ReducedChemistry ReduceMechanism(const mechanism_configuration::Mechanism& mechanism, const ReductionOptions& options)
+  {
+    if (options.target_species.empty())
+    {
+      throw std::invalid_argument("Mechanism reduction requires at least one target species");
+    }
+
+    const std::size_t n_species = mechanism.species.size();
+    std::unordered_map<std::string, std::size_t> species_index;
+    for (std::size_t i = 0; i < n_species; ++i)
+      species_index[mechanism.species[i].name] = i;
+
+    // Species that must survive regardless of their coupling to the targets
+    std::vector<bool> retained(n_species, false);
+    for (std::size_t i = 0; i < n_species; ++i)
+    {
+      const auto& species = mechanism.species[i];
+      retained[i] = species.is_third_body.value_or(false) || species.constant_concentration.has_value() ||
+                    species.constant_mixing_ratio.has_value() ||
+                    (species.tracer_type.has_value() && species.tracer_type.value() == "THIRD_BODY");
+    }
+    for (const auto& phase : mechanism.phases)
+    {
+      if (phase.name == "gas")
+        continue;
+      for (const auto& phase_species : phase.species)
+      {
+        auto it = species_index.find(phase_species.name);
+        if (it != species_index.end())
+          retained[it->second] = true;
+      }
+    }
+
+    std::vector<std::size_t> targets;
+    for (const auto& name : options.target_species)
+    {
+      auto it = species_index.find(name);
+      if (it == species_index.end())
+      {
+        throw musica::Exception(musica::MicmErrorCode::SpeciesNotFound, "Target species '" + name + "' not found");
+      }
+      targets.push_back(it->second);
+    }
+
+    std::vector<ReactionEntry> reactions;
+    ForEachReactionList(
+        mechanism.reactions,
+        [&](const auto& list, const std::string& prefix)
+        {
+          for (const auto& reaction : list)
+            reactions.push_back(MakeEntry(reaction, prefix, species_index));
+        });
+    const std::size_t n_reactions = reactions.size();
+
+    // Species concentrations for each sample condition
+    auto concentration = [&](const ReductionConditions& c, std::size_t i) -> double
+    {
+      const auto& species = mechanism.species[i];
+      if (species.is_third_body.value_or(false))
+        return c.air_density;
+      if (species.constant_concentration.has_value())
+        return species.constant_concentration.value();
+      if (species.constant_mixing_ratio.has_value())
+        return c.air_density * species.constant_mixing_ratio.value();
+      auto it = c.concentrations.find(species.name);
+      return it == c.concentrations.end() ? 0.0 : it->second;
+    };
+
+    // Reaction rates at each condition; reactions that cannot be evaluated are kept with all of their species
+    std::vector<std::vector<std::optional<double>>> rates(
+        options.sample_conditions.size(), std::vector<std::optional<double>>(n_reactions));
+    std::vector<bool> unresolved(n_reactions, options.sample_conditions.empty());
+    for (std::size_t c = 0; c < options.sample_conditions.size(); ++c)
+    {
+      const auto& conditions = options.sample_conditions[c];
+      for (std::size_t r = 0; r < n_reactions; ++r)
+      {
+        auto k = reactions[r].rate_constant(conditions);
+        if (!k.has_value())
+        {
+          unresolved[r] = true;
+          continue;
+        }
+        double rate = k.value();
+        for (const auto& [index, coefficient] : reactions[r].reactants)
+          rate *= std::pow(concentration(conditions, index), coefficient);
+        rates[c][r] = rate;
+      }
+    }
+    for (std::size_t r = 0; r < n_reactions; ++r)
+    {
+      if (!unresolved[r])
+        continue;
+      for (const auto& [index, coefficient] : reactions[r].reactants)
+        retained[index] = true;
+      for (const auto& [index, coefficient] : reactions[r].products)
+        retained[index] = true;
+    }
+
+    // Participants and net stoichiometry of each reaction
+    std::vector<std::unordered_map<std::size_t, double>> net_stoichiometry;
+    std::vector<std::unordered_set<std::size_t>> participants(n_reactions);
+    net_stoichiometry.reserve(n_reactions);
+    for (std::size_t r = 0; r < n_reactions; ++r)
+    {
+      net_stoichiometry.push_back(NetStoichiometry(reactions[r]));
+      for (const auto& [index, coefficient] : reactions[r].reactants)
+        participants[r].insert(index);
+      for (const auto& [index, coefficient] : reactions[r].products)
+        participants[r].insert(index);
+    }
+
+    // Maximum coupling coefficient r_AB over all sample conditions
+    std::vector<std::unordered_map<std::size_t, double>> coupling(n_species);
+    for (std::size_t c = 0; c < options.sample_conditions.size(); ++c)
+    {
+      std::vector<double> denominator(n_species, 0.0);
+      std::vector<std::unordered_map<std::size_t, double>> numerator(n_species);
+      for (std::size_t r = 0; r < n_reactions; ++r)
+      {
+        if (unresolved[r])
+          continue;
+        for (const auto& [a, nu] : net_stoichiometry[r])
+        {
+          const double contribution = std::abs(nu * rates[c][r].value());
+          denominator[a] += contribution;
+          for (const std::size_t b : participants[r])
+          {
+            if (b != a)
+              numerator[a][b] += contribution;
+          }
+        }
+      }
+      for (std::size_t a = 0; a < n_species; ++a)
+      {
+        if (denominator[a] <= 0.0)
+          continue;
+        for (const auto& [b, value] : numerator[a])
+          coupling[a][b] = std::max(coupling[a][b], value / denominator[a]);
+      }
+    }
+
+    // Depth-first search from the targets through strongly coupled species
+    std::vector<bool> reached(n_species, false);
+    std::vector<std::size_t> stack(targets.begin(), targets.end());
+    while (!stack.empty())
+    {
+      const std::size_t a = stack.back();
+      stack.pop_back();
+      if (reached[a])
+        continue;
+      reached[a] = true;
+      for (const auto& [b, value] : coupling[a])
+      {
+        if (!reached[b] && value >= options.threshold)
+          stack.push_back(b);
+      }
+    }
+    for (std::size_t i = 0; i < n_species; ++i)
+      retained[i] = retained[i] || reached[i];
+
+    // Reactions survive only when all of their species do
+    std::vector<bool> keep_reaction(n_reactions, true);
+    for (std::size_t r = 0; r < n_reactions; ++r)
+    {
+      for (const std::size_t index : participants[r])
+        keep_reaction[r] = keep_reaction[r] && retained[index];
+    }
+
+    // Error estimate: relative change in the net tendency of each target
+    double error_estimate = 0.0;
+    for (std::size_t c = 0; c < options.sample_conditions.size(); ++c)
+    {
+      for (const std::size_t t : targets)
+      {
+        double full = 0.0;
+        double reduced = 0.0;
+        double scale = 0.0;
+        for (std::size_t r = 0; r < n_reactions; ++r)
+        {
+          if (unresolved[r])
+            continue;
+          auto it = net_stoichiometry[r].find(t);
+          if (it == net_stoichiometry[r].end())
+            continue;
+          const double tendency = it->second * rates[c][r].value();
+          full += tendency;
+          scale += std::abs(tendency);
+          if (keep_reaction[r])
+            reduced += tendency;
+        }
+        if (scale > 0.0)
+          error_estimate = std::max(error_estimate, std::abs(full - reduced) / scale);
+      }
+    }
+
+    ReducedChemistry result;
+    result.mechanism = mechanism;
+    result.error_estimate = error_estimate;
+
+    result.mechanism.species.clear();
+    for (std::size_t i = 0; i < n_species; ++i)
+    {
+      if (retained[i])
+        result.mechanism.species.push_back(mechanism.species[i]);
+      else
+        result.removed_species.push_back(mechanism.species[i].name);
+    }
+    for (auto& phase : result.mechanism.phases)
+    {
+      std::erase_if(
+          phase.species,
+          [&](const auto& phase_species)
+          {
+            auto it = species_index.find(phase_species.name);
+            return it != species_index.end() && !retained[it->second];
+          });
+    }
+
+    std::size_t offset = 0;
+    ForEachReactionList(
+        result.mechanism.reactions,
+        [&](auto& list, const std::string&)
+        {
+          using List = std::decay_t<decltype(list)>;
+          List kept;
+          for (std::size_t i = 0; i < list.size(); ++i)
+          {
+            if (keep_reaction[offset + i])
+              kept.push_back(list[i]);
+          }
+          offset += list.size();
+          result.number_of_removed_reactions += list.size() - kept.size();
+          list = std::move(kept);
+        });
+
+    result.chemistry = ConvertChemistry(result.mechanism);
+    return result;
+  }
+
+}  // namespace musica
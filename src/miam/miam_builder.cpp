@@ -22,6 +22,7 @@
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace musica
 {
@@ -29,18 +30,6 @@ namespace musica
   {
     namespace types = mechanism_configuration::types;
 
-    // ── Convert a mechanism_configuration Species to a micm::Species ─
-
-    micm::Species ConvertSpecies(const types::Species& def)
-    {
-      micm::Species s{ def.name };
-      if (def.molecular_weight.has_value())
-        s.SetProperty("molecular weight [kg mol-1]", def.molecular_weight.value());
-      if (def.density.has_value())
-        s.SetProperty("density [kg m-3]", def.density.value());
-      return s;
-    }
-
     // ── Resolve a rate-constant config to std::function ─────────────
 
     /// Wrapper that provides a Calculate() method for template-based builders
@@ -374,44 +363,30 @@ namespace musica
           message += "\n  - " + msg;
         throw musica::Exception(musica::MiamErrorCode::InvalidAerosolConfiguration, message);
       }
-      // Build the species map from the mechanism's species list.
-      std::unordered_map<std::string, micm::Species> species_map;
+      // Phases may only reference declared species; the conversion below looks
+      // species up by name and would otherwise intern an empty one.
+      std::unordered_set<std::string> species_names;
       for (const auto& sp : mechanism.species)
-        species_map[sp.name] = ConvertSpecies(sp);
-
-      // Build the phase map from the mechanism's phases (gas + condensed).
-      std::unordered_map<std::string, micm::Phase> phase_map;
+        species_names.insert(sp.name);
       for (const auto& ph : mechanism.phases)
       {
-        std::vector<micm::PhaseSpecies> phase_species;
         for (const auto& ps : ph.species)
         {
-          auto it = species_map.find(ps.name);
-          if (it == species_map.end())
+          if (!species_names.contains(ps.name))
             throw musica::Exception(
                 musica::MiamErrorCode::SpeciesNotFound,
                 "MIAM: Species '" + ps.name + "' in phase '" + ph.name + "' not found");
-          // Carry the phase-specific properties (diffusion coefficient, density) from
-          // the config's PhaseSpecies onto the micm::PhaseSpecies MIAM reads.
-          micm::PhaseSpecies phase_sp(it->second);
-          if (ps.diffusion_coefficient.has_value())
-            phase_sp.SetDiffusionCoefficient(ps.diffusion_coefficient.value());
-          if (ps.density.has_value())
-            phase_sp.SetDensity(ps.density.value());
-          phase_species.push_back(phase_sp);
         }
-        phase_map[ph.name] = micm::Phase(ph.name, phase_species);
       }
 
-      // Gas-phase chemistry is derived from the mechanism (single source of truth).
-      const Chemistry chemistry = ConvertChemistry(mechanism);
-
-      // Overlay the mechanism's gas phase from the built chemistry so linear
-      // constraints referencing it get the exact micm gas-phase object.
-      phase_map[chemistry.system.gas_phase_.name_] = chemistry.system.gas_phase_;
+      // Convert the mechanism once: the gas-phase chemistry and the MIAM model share the
+      // same species and phases (gas + condensed, with their phase-specific properties),
+      // so linear constraints referencing the gas phase get the exact micm gas-phase object.
+      ChemistryTables tables;
+      const Chemistry chemistry = ConvertChemistry(mechanism, tables);
 
       // Build the miam::Model
-      auto miam_model = BuildMiamModel(mechanism.name, mechanism.aerosol.value(), species_map, phase_map);
+      auto miam_model = BuildMiamModel(mechanism.name, mechanism.aerosol.value(), tables.species, tables.phases);
 
       // Build solver with MIAM as external model
       auto solver_variant = BuildSolverVariant(chemistry.system.gas_phase_, chemistry.processes, solver_type, miam_model);
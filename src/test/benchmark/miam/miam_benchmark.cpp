@@ -0,0 +1,569 @@
+// Copyright (C) 2023-2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Benchmarks building and solving MICM with a MIAM aerosol model attached
+//
+// The cloud-sulfate aqueous chemistry of the MIAM unit tests is attached to each
+// representation of the CAM aerosol distributions in python/musica/examples/cam_aerosol_configs.py
+// (MAM modes, BAM bulk modes and bins, CARMA sections), to the single cloud section of the unit
+// tests, and to sweeps of 1-32 UniformSection, SingleMomentMode and TwoMomentMode representations.
+// For each solver type the solver build is timed, and solves are timed for several numbers of
+// grid cells. Results are written as JSON to the file given as the only argument, or to stdout.
+#include <musica/miam/miam_builder.hpp>
+#include <musica/micm/micm.hpp>
+#include <musica/micm/state.hpp>
+
+#include <mechanism_configuration/mechanism_configuration.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace musica;
+
+namespace
+{
+  namespace types = mechanism_configuration::types;
+
+  constexpr std::size_t CREATE_ITERATIONS = 3;
+  constexpr std::size_t SOLVE_ITERATIONS = 10;
+  constexpr double TIME_STEP = 0.01;        // [s]
+  constexpr double TEMPERATURE = 280.0;     // [K]
+  constexpr double PRESSURE = 70000.0;      // [Pa]
+  constexpr double GAS_CONSTANT = 8.314;    // [J mol-1 K-1]
+  constexpr double MODE_RADIUS = 1.0e-6;    // [m] mean radius used to set two-moment number concentrations
+  constexpr double PI = 3.14159265358979323846;
+
+  // Unit-conversion constants, as in cam_aerosol_configs.py
+  constexpr double M_ATM_TO_MOL_M3_PA = 1000.0 / 101325.0;
+  constexpr double C_H2O_M = 55.556;  // [mol L-1] rate and equilibrium constant conversion only
+  constexpr double MW_H2O = 0.018;    // [kg mol-1]
+  constexpr double RHO_H2O = 1000.0;  // [kg m-3]
+  constexpr double UM = 1.0e-6;       // [um -> m]
+  constexpr double CM_TO_M = 1.0e-2;  // [cm -> m]
+
+  // Initial conditions of the MIAM cloud chemistry tests [mol m-3 air]. Condensed-phase
+  // amounts are divided evenly among the representations.
+  constexpr double LIQUID_WATER = 0.3e-3 / MW_H2O;
+  constexpr double SULFATE = 1.0;
+  constexpr double TRACE = 1.0e-10;
+
+  struct SpeciesProperties
+  {
+    const char* name;
+    double molecular_weight;  // [kg mol-1]
+    double density;           // [kg m-3]
+  };
+
+  const SpeciesProperties gas_species[] = { { "SO2", 0.064, 0.0 }, { "H2O2", 0.034, 0.0 }, { "O3", 0.048, 0.0 } };
+  const double gas_concentrations[] = { 3.01e-8, 3.01e-8, 1.5e-6 };
+
+  const SpeciesProperties aqueous_species[] = { { "H2O", MW_H2O, RHO_H2O },     { "SO2_aq", 0.064, 1000.0 },
+                                                { "H2O2_aq", 0.034, 1000.0 },  { "O3_aq", 0.048, 1000.0 },
+                                                { "Hp", 0.001, 1000.0 },       { "OHm", 0.017, 1000.0 },
+                                                { "HSO3m", 0.081, 1000.0 },    { "SO3mm", 0.080, 1000.0 },
+                                                { "SO4mm", 0.096, 1000.0 },    { "SO2OOHm", 0.097, 1000.0 } };
+
+  using Representation = std::variant<types::UniformSection, types::SingleMomentMode, types::TwoMomentMode>;
+
+  struct Setup
+  {
+    std::string name;
+    std::vector<Representation> representations;
+  };
+
+  struct Timing
+  {
+    double min;
+    double mean;
+    double max;
+  };
+
+  const MICMSolver solver_types[] = { MICMSolver::RosenbrockDAE4,
+                                      MICMSolver::RosenbrockDAE4StandardOrder,
+                                      MICMSolver::RosenbrockDAE6,
+                                      MICMSolver::RosenbrockDAE6StandardOrder };
+
+  const std::size_t grid_cells[] = { 1, 10, 100, 1000 };
+
+  const std::size_t sweep_sizes[] = { 1, 2, 4, 8, 16, 32 };
+
+  void Check(Error& error, const std::string& context)
+  {
+    if (IsSuccess(error))
+      return;
+    std::cerr << context << ": " << (error.message_.value_ ? error.message_.value_ : "unknown error") << std::endl;
+    DeleteError(&error);
+    std::exit(EXIT_FAILURE);
+  }
+
+  template<typename Function>
+  Timing Time(const std::size_t iterations, Function&& function)
+  {
+    Timing timing{ 0.0, 0.0, 0.0 };
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      function();
+      const auto end = std::chrono::steady_clock::now();
+      const double elapsed = std::chrono::duration<double, std::micro>(end - start).count();
+      timing.min = i == 0 ? elapsed : std::min(timing.min, elapsed);
+      timing.max = std::max(timing.max, elapsed);
+      timing.mean += elapsed / static_cast<double>(iterations);
+    }
+    return timing;
+  }
+
+  std::string Numbered(const std::string& prefix, const std::size_t number)
+  {
+    char suffix[8];
+    std::snprintf(suffix, sizeof(suffix), "%02zu", number);
+    return prefix + suffix;
+  }
+
+  std::string RepresentationName(const Representation& representation)
+  {
+    return std::visit([](const auto& r) { return r.name; }, representation);
+  }
+
+  std::string RepresentationType(const Representation& representation)
+  {
+    const char* names[] = { "UniformSection", "SingleMomentMode", "TwoMomentMode" };
+    return names[representation.index()];
+  }
+
+  // ── CAM aerosol distributions (cam_aerosol_configs.py) ──
+
+  std::vector<Representation> MamModes(const std::vector<std::pair<const char*, double>>& modes)
+  {
+    std::vector<Representation> representations;
+    for (const auto& [name, sigma] : modes)
+    {
+      std::string upper = name;
+      std::transform(upper.begin(), upper.end(), upper.begin(), [](unsigned char c) { return std::toupper(c); });
+      representations.push_back(types::TwoMomentMode{ .name = upper, .geometric_standard_deviation = sigma });
+    }
+    return representations;
+  }
+
+  std::vector<Representation> BamModes()
+  {
+    std::vector<Representation> representations;
+    const std::tuple<const char*, double, double> bulk[] = { { "SO4", 6.95e-6 * CM_TO_M, 2.03 },
+                                                             { "OC", 2.12e-6 * CM_TO_M, 2.20 },
+                                                             { "BC", 1.18e-6 * CM_TO_M, 2.00 },
+                                                             { "NH4NO3", 6.95e-6 * CM_TO_M, 2.03 } };
+    for (const auto& [name, radius, sigma] : bulk)
+    {
+      representations.push_back(
+          types::SingleMomentMode{ .name = name, .geometric_mean_radius = radius, .geometric_standard_deviation = sigma });
+    }
+    const double dust_diameter_edges[] = { 0.1, 1.0, 2.5, 5.0, 10.0 };  // [um]
+    for (std::size_t i = 0; i + 1 < std::size(dust_diameter_edges); ++i)
+    {
+      representations.push_back(types::SingleMomentMode{
+          .name = Numbered("DST", i + 1),
+          .geometric_mean_radius = 0.5 * std::sqrt(dust_diameter_edges[i] * dust_diameter_edges[i + 1]) * UM,
+          .geometric_standard_deviation = 2.0 });
+    }
+    const double sea_salt_diameters[] = { 0.52, 2.38, 4.86, 15.14 };  // [um]
+    for (std::size_t i = 0; i < std::size(sea_salt_diameters); ++i)
+    {
+      representations.push_back(types::SingleMomentMode{ .name = Numbered("SSLT", i + 1),
+                                                         .geometric_mean_radius = 0.5 * sea_salt_diameters[i] * UM,
+                                                         .geometric_standard_deviation = 2.0 });
+    }
+    return representations;
+  }
+
+  // CARMA bin centers are minimum_radius * volume_ratio^((i-1)/3), with edges a factor
+  // volume_ratio^(1/6) either side
+  std::vector<Representation> CarmaSections(
+      const std::string& group,
+      const std::size_t number_of_bins,
+      const double minimum_radius,
+      const double volume_ratio)
+  {
+    std::vector<Representation> representations;
+    const double edge_factor = std::pow(volume_ratio, 1.0 / 6.0);
+    for (std::size_t i = 1; i <= number_of_bins; ++i)
+    {
+      const double center = minimum_radius * std::pow(volume_ratio, static_cast<double>(i - 1) / 3.0);
+      representations.push_back(types::UniformSection{ .name = Numbered(group + "_BIN", i),
+                                                       .min_radius = center / edge_factor,
+                                                       .max_radius = center * edge_factor });
+    }
+    return representations;
+  }
+
+  // ── Representation count sweeps, spanning 10 nm to 10 um ──
+
+  std::vector<Representation> Sweep(const std::size_t type_index, const std::size_t number_of_representations)
+  {
+    constexpr double smallest = 1.0e-8;  // [m]
+    constexpr double largest = 1.0e-5;   // [m]
+    const double ratio = std::pow(largest / smallest, 1.0 / static_cast<double>(number_of_representations));
+    std::vector<Representation> representations;
+    for (std::size_t i = 0; i < number_of_representations; ++i)
+    {
+      const double lower = smallest * std::pow(ratio, static_cast<double>(i));
+      const double upper = lower * ratio;
+      if (type_index == 0)
+        representations.push_back(
+            types::UniformSection{ .name = Numbered("SECTION", i + 1), .min_radius = lower, .max_radius = upper });
+      else if (type_index == 1)
+        representations.push_back(types::SingleMomentMode{ .name = Numbered("MODE", i + 1),
+                                                           .geometric_mean_radius = std::sqrt(lower * upper),
+                                                           .geometric_standard_deviation = 1.6 });
+      else
+        representations.push_back(
+            types::TwoMomentMode{ .name = Numbered("MODE", i + 1), .geometric_standard_deviation = 1.6 });
+    }
+    return representations;
+  }
+
+  std::vector<Setup> Setups()
+  {
+    std::vector<Setup> setups = {
+      { "cloud", { types::UniformSection{ .name = "CLOUD", .min_radius = 1.0e-6, .max_radius = 1.0e-5 } } },
+      { "mam3", MamModes({ { "accum", 1.8 }, { "aitken", 1.6 }, { "coarse", 1.8 } }) },
+      { "mam4", MamModes({ { "accum", 1.8 }, { "aitken", 1.6 }, { "coarse", 1.8 }, { "primary_carbon", 1.6 } }) },
+      { "mam7",
+        MamModes({ { "accum", 1.8 },
+                   { "aitken", 1.6 },
+                   { "primary_carbon", 1.6 },
+                   { "fine_seasalt", 2.0 },
+                   { "fine_dust", 1.8 },
+                   { "coarse_seasalt", 2.0 },
+                   { "coarse_dust", 1.8 } }) },
+      { "bam", BamModes() },
+      { "carma_dust", CarmaSections("DUST", 16, 1.19e-5 * CM_TO_M, 2.371) },
+      { "carma_sulfate", CarmaSections("SULFATE", 30, 3.43230298e-8 * CM_TO_M, 2.4) },
+    };
+    const char* sweep_names[] = { "uniform_section", "single_moment_mode", "two_moment_mode" };
+    for (std::size_t type_index = 0; type_index < std::size(sweep_names); ++type_index)
+    {
+      for (const std::size_t size : sweep_sizes)
+        setups.push_back({ std::string(sweep_names[type_index]) + "_" + std::to_string(size), Sweep(type_index, size) });
+    }
+    return setups;
+  }
+
+  // ── Mechanism: the cloud-sulfate chemistry on each representation's own aqueous phase ──
+
+  std::vector<types::ReactionComponent> Components(const std::vector<std::string>& names)
+  {
+    std::vector<types::ReactionComponent> components;
+    for (const auto& name : names)
+    {
+      types::ReactionComponent component;
+      component.name = name;
+      components.push_back(component);
+    }
+    return components;
+  }
+
+  std::string AqueousPhase(const std::string& representation_name)
+  {
+    return representation_name + "_AQ";
+  }
+
+  void AddSulfateChemistry(const std::string& phase, types::Aerosol& aerosol)
+  {
+    auto reaction = [&phase](
+                        const std::vector<std::string>& reactants,
+                        const std::vector<std::string>& products,
+                        double A,
+                        double C)
+    {
+      types::DissolvedReaction r;
+      r.phase = phase;
+      r.solvent = "H2O";
+      r.reactants = Components(reactants);
+      r.products = Components(products);
+      r.rate_constant = types::Arrhenius{ .A = C_H2O_M * A, .C = C };
+      return r;
+    };
+    types::DissolvedReversibleReaction r1a;
+    r1a.phase = phase;
+    r1a.solvent = "H2O";
+    r1a.reactants = Components({ "HSO3m", "H2O2_aq" });
+    r1a.products = Components({ "SO2OOHm", "H2O" });
+    r1a.forward_rate_constant = types::Arrhenius{ .A = C_H2O_M * (7.45e7 / 13.0), .C = 4430.0 };
+    r1a.equilibrium_constant = types::Equilibrium{ .A = 1725.0, .C = 0.0 };
+    aerosol.processes.push_back(r1a);
+    aerosol.processes.push_back(reaction({ "SO2OOHm", "Hp" }, { "SO4mm" }, 2.4e6, 4430.0));
+    aerosol.processes.push_back(reaction({ "HSO3m", "O3_aq" }, { "SO4mm", "Hp" }, 3.75e5, 5530.0));
+    aerosol.processes.push_back(reaction({ "SO3mm", "O3_aq" }, { "SO4mm" }, 1.59e9, 5280.0));
+
+    const std::tuple<const char*, const char*, double, double> henrys_law[] = {
+      { "SO2", "SO2_aq", 1.23, 3120.0 }, { "H2O2", "H2O2_aq", 7.4e4, 6621.0 }, { "O3", "O3_aq", 1.15e-2, 2560.0 }
+    };
+    for (const auto& [gas, condensed, hlc_ref, C] : henrys_law)
+    {
+      types::HenrysLawEquilibrium h;
+      h.gas_phase = "gas";
+      h.gas_species = gas;
+      h.condensed_phase = phase;
+      h.condensed_species = condensed;
+      h.solvent = "H2O";
+      h.henrys_law_constant.HLC_ref = hlc_ref * M_ATM_TO_MOL_M3_PA;
+      h.henrys_law_constant.C = C;
+      h.solvent_molecular_weight = MW_H2O;
+      h.solvent_density = RHO_H2O;
+      aerosol.constraints.push_back(h);
+    }
+
+    auto equilibrium = [&phase](
+                           const std::vector<std::string>& reactants,
+                           const std::vector<std::string>& products,
+                           const std::string& algebraic_species,
+                           types::Equilibrium constant)
+    {
+      types::DissolvedEquilibrium d;
+      d.phase = phase;
+      d.reactants = Components(reactants);
+      d.products = Components(products);
+      d.algebraic_species = algebraic_species;
+      d.solvent = "H2O";
+      d.equilibrium_constant = constant;
+      return d;
+    };
+    aerosol.constraints.push_back(
+        equilibrium({ "H2O" }, { "Hp", "OHm" }, "OHm", { .A = 1e-14 / (C_H2O_M * C_H2O_M), .C = 0.0 }));
+    aerosol.constraints.push_back(
+        equilibrium({ "SO2_aq" }, { "HSO3m", "Hp" }, "HSO3m", { .A = 1.7e-2 / C_H2O_M, .C = 2090.0 }));
+    aerosol.constraints.push_back(
+        equilibrium({ "HSO3m" }, { "SO3mm", "Hp" }, "SO3mm", { .A = 6.0e-8 / C_H2O_M, .C = 1120.0 }));
+
+    // Charge balance: H+ = OH- + HSO3- + 2*SO3-- + 2*SO4-- + SO2OOH-
+    types::LinearConstraint charge_balance;
+    charge_balance.algebraic_phase = phase;
+    charge_balance.algebraic_species = "Hp";
+    charge_balance.terms = { { .phase = phase, .name = "Hp", .coefficient = 1.0 },
+                             { .phase = phase, .name = "OHm", .coefficient = -1.0 },
+                             { .phase = phase, .name = "HSO3m", .coefficient = -1.0 },
+                             { .phase = phase, .name = "SO3mm", .coefficient = -2.0 },
+                             { .phase = phase, .name = "SO4mm", .coefficient = -2.0 },
+                             { .phase = phase, .name = "SO2OOHm", .coefficient = -1.0 } };
+    charge_balance.constant = types::FixedConstant{ 0.0 };
+    aerosol.constraints.push_back(charge_balance);
+  }
+
+  mechanism_configuration::Mechanism BuildMechanism(const Setup& setup)
+  {
+    mechanism_configuration::Mechanism mechanism;
+    mechanism.name = setup.name;
+    types::Phase gas;
+    gas.name = "gas";
+    for (const auto& properties : gas_species)
+    {
+      types::Species species;
+      species.name = properties.name;
+      species.molecular_weight = properties.molecular_weight;
+      mechanism.species.push_back(species);
+      types::PhaseSpecies phase_species;
+      phase_species.name = properties.name;
+      gas.species.push_back(phase_species);
+    }
+    mechanism.phases.push_back(gas);
+    for (const auto& properties : aqueous_species)
+    {
+      types::Species species;
+      species.name = properties.name;
+      species.molecular_weight = properties.molecular_weight;
+      species.density = properties.density;
+      mechanism.species.push_back(species);
+    }
+
+    types::Aerosol aerosol;
+    for (const auto& representation : setup.representations)
+    {
+      const std::string phase_name = AqueousPhase(RepresentationName(representation));
+      types::Phase phase;
+      phase.name = phase_name;
+      for (const auto& properties : aqueous_species)
+      {
+        types::PhaseSpecies phase_species;
+        phase_species.name = properties.name;
+        phase.species.push_back(phase_species);
+      }
+      mechanism.phases.push_back(phase);
+      std::visit(
+          [&](auto r)
+          {
+            r.phases = { phase_name };
+            aerosol.representations.push_back(r);
+          },
+          representation);
+      AddSulfateChemistry(phase_name, aerosol);
+    }
+    mechanism.aerosol = std::move(aerosol);
+    return mechanism;
+  }
+
+  // ── Initial state ──
+
+  void InitializeState(const Setup& setup, State& state, const MICMSolver solver_type)
+  {
+    const std::size_t number_of_cells = state.NumberOfGridCells();
+    const double fraction = 1.0 / static_cast<double>(setup.representations.size());
+    auto uniform = [number_of_cells](double value) { return std::vector<double>(number_of_cells, value); };
+
+    std::map<std::string, std::vector<double>> concentrations;
+    std::map<std::string, std::vector<double>> parameters;
+    for (std::size_t i = 0; i < std::size(gas_species); ++i)
+      concentrations[gas_species[i].name] = uniform(gas_concentrations[i]);
+    for (const auto& representation : setup.representations)
+    {
+      const std::string name = RepresentationName(representation);
+      const std::string prefix = name + "." + AqueousPhase(name) + ".";
+      double volume = 0.0;  // [m3 m-3 air]
+      for (const auto& properties : aqueous_species)
+      {
+        const std::string species = properties.name;
+        double concentration = TRACE;
+        if (species == "H2O")
+          concentration = LIQUID_WATER;
+        else if (species == "SO4mm")
+          concentration = SULFATE;
+        else if (species == "Hp")
+          concentration = 2.0 * SULFATE;
+        else if (species == "SO2OOHm")
+          concentration = 0.0;
+        concentration *= fraction;
+        concentrations[prefix + species] = uniform(concentration);
+        volume += concentration * properties.molecular_weight / properties.density;
+      }
+      std::visit(
+          [&](const auto& r)
+          {
+            using T = std::decay_t<decltype(r)>;
+            if constexpr (std::is_same_v<T, types::UniformSection>)
+            {
+              parameters[name + ".MIN_RADIUS"] = uniform(r.min_radius);
+              parameters[name + ".MAX_RADIUS"] = uniform(r.max_radius);
+            }
+            else if constexpr (std::is_same_v<T, types::SingleMomentMode>)
+            {
+              parameters[name + ".GEOMETRIC_MEAN_RADIUS"] = uniform(r.geometric_mean_radius);
+              parameters[name + ".GEOMETRIC_STANDARD_DEVIATION"] = uniform(r.geometric_standard_deviation);
+            }
+            else
+            {
+              parameters[name + ".GEOMETRIC_STANDARD_DEVIATION"] = uniform(r.geometric_standard_deviation);
+              concentrations[name + ".NUMBER_CONCENTRATION"] =
+                  uniform(volume / (4.0 / 3.0 * PI * MODE_RADIUS * MODE_RADIUS * MODE_RADIUS));
+            }
+          },
+          representation);
+    }
+
+    micm::Conditions conditions;
+    conditions.temperature_ = TEMPERATURE;
+    conditions.pressure_ = PRESSURE;
+    conditions.air_density_ = PRESSURE / (GAS_CONSTANT * TEMPERATURE);
+    state.SetConditions(std::vector<micm::Conditions>(number_of_cells, conditions));
+    state.SetConcentrations(concentrations, solver_type);
+    state.SetRateConstants(parameters, solver_type);
+  }
+
+  std::unique_ptr<MICM> CreateSolver(const mechanism_configuration::Mechanism& mechanism, const MICMSolver solver_type)
+  {
+    Error error;
+    std::unique_ptr<MICM> micm{ CreateMicmWithMiam(mechanism, solver_type, &error) };
+    Check(error, "Error creating MICM with MIAM for " + mechanism.name + " (" + ToString(solver_type) + ")");
+    DeleteError(&error);
+    return micm;
+  }
+
+  void WriteTiming(std::ostream& out, const Timing& timing)
+  {
+    out << "{ \"min\": " << timing.min << ", \"mean\": " << timing.mean << ", \"max\": " << timing.max << " }";
+  }
+
+  void Benchmark(const Setup& setup, const MICMSolver solver_type, std::ostream& out)
+  {
+    const mechanism_configuration::Mechanism mechanism = BuildMechanism(setup);
+    const Timing create_timing = Time(CREATE_ITERATIONS, [&]() { CreateSolver(mechanism, solver_type); });
+    const std::unique_ptr<MICM> micm = CreateSolver(mechanism, solver_type);
+
+    out << "    {\n"
+        << "      \"setup\": \"" << setup.name << "\",\n"
+        << "      \"representation_type\": \"" << RepresentationType(setup.representations.front()) << "\",\n"
+        << "      \"representations\": " << setup.representations.size() << ",\n"
+        << "      \"solver\": \"" << ToString(solver_type) << "\",\n"
+        << "      \"create_us\": ";
+    WriteTiming(out, create_timing);
+    out << ",\n      \"solve\": [\n";
+    for (std::size_t i_cells = 0; i_cells < std::size(grid_cells); ++i_cells)
+    {
+      const std::size_t number_of_cells = grid_cells[i_cells];
+      State state(*micm, number_of_cells);
+      InitializeState(setup, state, solver_type);
+      std::size_t converged = 0;
+      const Timing solve_timing = Time(
+          SOLVE_ITERATIONS,
+          [&]()
+          {
+            const micm::SolverResult result = micm->Solve(&state, TIME_STEP);
+            converged += result.state_ == micm::SolverState::Converged ? 1 : 0;
+          });
+      out << "        { \"grid_cells\": " << number_of_cells << ", \"species\": " << state.NumberOfSpecies()
+          << ", \"converged\": " << converged << ", \"cells_per_second\": "
+          << static_cast<double>(number_of_cells) / (solve_timing.mean * 1.0e-6) << ", \"solve_us\": ";
+      WriteTiming(out, solve_timing);
+      out << " }" << (i_cells + 1 < std::size(grid_cells) ? "," : "") << "\n";
+    }
+    out << "      ]\n    }";
+  }
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  std::ofstream file;
+  if (argc > 1)
+  {
+    file.open(argv[1]);
+    if (!file)
+    {
+      std::cerr << "Unable to open " << argv[1] << " for writing" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  std::ostream& out = argc > 1 ? file : std::cout;
+
+  out << "{\n"
+      << "  \"create_iterations\": " << CREATE_ITERATIONS << ",\n"
+      << "  \"solve_iterations\": " << SOLVE_ITERATIONS << ",\n"
+      << "  \"time_step_s\": " << TIME_STEP << ",\n"
+      << "  \"temperature_K\": " << TEMPERATURE << ",\n"
+      << "  \"pressure_Pa\": " << PRESSURE << ",\n"
+      << "  \"results\": [\n";
+  bool first = true;
+  for (const Setup& setup : Setups())
+  {
+    for (const MICMSolver solver_type : solver_types)
+    {
+      out << (first ? "" : ",\n");
+      Benchmark(setup, solver_type, out);
+      first = false;
+    }
+  }
+  out << "\n  ]\n}\n";
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,411 @@
+// Copyright (C) 2023-2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Benchmarks creating and running TUV-x for the configurations in configs/tuvx
+//
+// Each configuration is timed at its native size and with the number of height layers,
+// wavelength bins and photolysis reactions varied one at a time. Runs are timed for several
+// sets of requested outputs. Results are written as JSON to the file given as the only
+// argument, or to stdout. Run from the build directory so the configuration paths resolve.
+#include <musica/tuvx/tuvx.hpp>
+#include <musica/tuvx/tuvx_c_interface.hpp>
+
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace musica;
+
+namespace
+{
+  constexpr std::size_t CREATE_ITERATIONS = 3;
+  constexpr std::size_t RUN_ITERATIONS = 20;
+  constexpr double SOLAR_ZENITH_ANGLE = 0.1;  // [radians]
+  constexpr double EARTH_SUN_DISTANCE = 1.0;  // [AU]
+
+  // Vertical and spectral domains of the test configurations, which are subdivided
+  // evenly when the number of layers or wavelength bins is varied
+  constexpr double BOTTOM_HEIGHT = 0.0;      // [km]
+  constexpr double TOP_HEIGHT = 3.0;         // [km]
+  constexpr double MIN_WAVELENGTH = 300.0;   // [nm]
+  constexpr double MAX_WAVELENGTH = 800.0;   // [nm]
+  constexpr double EXO_SCALE_HEIGHT = 8.5;   // [km]
+  constexpr double KM_TO_CM = 1.0e5;
+
+  // Which grids and profiles the host provides for a configuration
+  enum class HostData
+  {
+    None,                 // everything comes from the configuration
+    GridsAndTemperature,  // height and wavelength grids and the temperature profile
+    All                   // all grids and profiles
+  };
+
+  struct Setup
+  {
+    const char* name;
+    const char* config_path;
+    HostData host_data;
+  };
+
+  struct Size
+  {
+    std::size_t layers;
+    std::size_t wavelengths;
+    std::size_t reactions;
+  };
+
+  struct OutputSet
+  {
+    const char* name;
+    unsigned int outputs;
+  };
+
+  struct Timing
+  {
+    double min;
+    double mean;
+    double max;
+  };
+
+  const Setup setups[] = { { "fixed", "configs/tuvx/fixed/config.json", HostData::None },
+                           { "from_host", "configs/tuvx/from_host/config.json", HostData::GridsAndTemperature },
+                           { "full_from_host", "configs/tuvx/full_from_host/config.json", HostData::All } };
+
+  // The native size of the test configurations, followed by one-at-a-time variations
+  const Size sizes[] = { { 3, 5, 3 },   { 30, 5, 3 }, { 120, 5, 3 }, { 3, 50, 3 },
+                         { 3, 150, 3 }, { 3, 5, 1 },  { 3, 5, 12 } };
+
+  const OutputSet output_sets[] = {
+    { "photolysis_rate_constants", TuvxOutput::PHOTOLYSIS_RATE_CONSTANTS },
+    { "photolysis_and_heating_rates", TuvxOutput::PHOTOLYSIS_RATE_CONSTANTS | TuvxOutput::HEATING_RATES },
+    { "rates", TuvxOutput::PHOTOLYSIS_RATE_CONSTANTS | TuvxOutput::HEATING_RATES | TuvxOutput::DOSE_RATES },
+    { "all_outputs", TuvxOutput::ALL_OUTPUTS }
+  };
+
+  void Check(Error& error, const std::string& context)
+  {
+    if (IsSuccess(error))
+      return;
+    std::cerr << context << ": " << (error.message_.value_ ? error.message_.value_ : "unknown error") << std::endl;
+    DeleteError(&error);
+    std::exit(EXIT_FAILURE);
+  }
+
+  template<typename Function>
+  Timing Time(const std::size_t iterations, Function&& function)
+  {
+    Timing timing{ 0.0, 0.0, 0.0 };
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      function();
+      const auto end = std::chrono::steady_clock::now();
+      const double elapsed = std::chrono::duration<double, std::micro>(end - start).count();
+      timing.min = i == 0 ? elapsed : std::min(timing.min, elapsed);
+      timing.max = std::max(timing.max, elapsed);
+      timing.mean += elapsed / static_cast<double>(iterations);
+    }
+    return timing;
+  }
+
+  std::vector<double> Linspace(const double first, const double last, const std::size_t number_of_values)
+  {
+    std::vector<double> values(number_of_values);
+    for (std::size_t i = 0; i < number_of_values; ++i)
+      values[i] = first + (last - first) * static_cast<double>(i) / static_cast<double>(number_of_values - 1);
+    return values;
+  }
+
+  // Linearly resamples values at evenly spaced points onto a different number of evenly spaced points
+  std::vector<double> Resample(const std::vector<double>& values, const std::size_t number_of_values)
+  {
+    std::vector<double> resampled(number_of_values);
+    for (std::size_t i = 0; i < number_of_values; ++i)
+    {
+      const double position =
+          static_cast<double>(i) * static_cast<double>(values.size() - 1) / static_cast<double>(number_of_values - 1);
+      const std::size_t lower = std::min(static_cast<std::size_t>(position), values.size() - 2);
+      const double weight = position - static_cast<double>(lower);
+      resampled[i] = (1.0 - weight) * values[lower] + weight * values[lower + 1];
+    }
+    return resampled;
+  }
+
+  std::vector<double> Midpoints(const std::vector<double>& edges)
+  {
+    std::vector<double> midpoints(edges.size() - 1);
+    for (std::size_t i = 0; i < midpoints.size(); ++i)
+      midpoints[i] = 0.5 * (edges[i] + edges[i + 1]);
+    return midpoints;
+  }
+
+  // Resizes the height and wavelength grids and the profiles on them, and replicates the
+  // photolysis reactions (with unique names) to reach the requested number of reactions
+  std::string ResizeConfig(const Setup& setup, const Size& size)
+  {
+    YAML::Node config = YAML::LoadFile(setup.config_path);
+    auto number_of_edges = [&size](const std::string& grid_name)
+    { return (grid_name == "height" ? size.layers : size.wavelengths) + 1; };
+    for (auto grid : config["grids"])
+    {
+      const std::string name = grid["name"].as<std::string>();
+      if (name != "height" && name != "wavelength")
+        continue;
+      const auto values = grid["values"].as<std::vector<double>>();
+      grid["values"] = Linspace(values.front(), values.back(), number_of_edges(name));
+    }
+    for (auto profile : config["profiles"])
+    {
+      const std::string grid_name = profile["grid"]["name"].as<std::string>();
+      if ((grid_name != "height" && grid_name != "wavelength") || !profile["values"])
+        continue;
+      profile["values"] = Resample(profile["values"].as<std::vector<double>>(), number_of_edges(grid_name));
+    }
+    YAML::Node reactions = config["photolysis"]["reactions"];
+    YAML::Node resized_reactions(YAML::NodeType::Sequence);
+    for (std::size_t i = 0; i < size.reactions; ++i)
+    {
+      YAML::Node reaction = YAML::Clone(reactions[i % reactions.size()]);
+      if (i >= reactions.size())
+        reaction["name"] = reaction["name"].as<std::string>() + "_" + std::to_string(i);
+      resized_reactions.push_back(reaction);
+    }
+    config["photolysis"]["reactions"] = resized_reactions;
+    YAML::Emitter emitter;
+    emitter << config;
+    return emitter.c_str();
+  }
+
+  void AddHostGrid(GridMap* grids, const char* name, const char* units, const std::vector<double>& edges)
+  {
+    Error error;
+    Grid* grid = CreateGrid(name, units, edges.size() - 1, &error);
+    Check(error, "Error creating host grid");
+    std::vector<double> values = edges;
+    SetGridEdges(grid, values.data(), values.size(), &error);
+    Check(error, "Error setting host grid edges");
+    values = Midpoints(edges);
+    SetGridMidpoints(grid, values.data(), values.size(), &error);
+    Check(error, "Error setting host grid midpoints");
+    AddGrid(grids, grid, &error);
+    Check(error, "Error adding host grid");
+    DeleteGrid(grid, &error);
+    DeleteError(&error);
+  }
+
+  void AddHostProfile(GridMap* grids, ProfileMap* profiles, const char* name, const char* units, const char* grid_name)
+  {
+    Error error;
+    Grid* grid = GetGrid(grids, grid_name, grid_name == std::string("height") ? "km" : "nm", &error);
+    Check(error, "Error getting host grid");
+    Profile* profile = CreateProfile(name, units, grid, &error);
+    Check(error, "Error creating host profile");
+    AddProfile(profiles, profile, &error);
+    Check(error, "Error adding host profile");
+    DeleteProfile(profile, &error);
+    DeleteGrid(grid, &error);
+    DeleteError(&error);
+  }
+
+  // Sets the values of a host profile in a TUV-x instance from values at the native edges of the
+  // test configurations, optionally with layer densities and an exo-atmospheric layer density
+  void SetHostProfile(
+      ProfileMap* profiles,
+      const char* name,
+      const char* units,
+      const std::vector<double>& native_edge_values,
+      const std::vector<double>& grid_edges,
+      const bool with_layer_densities)
+  {
+    Error error;
+    Profile* profile = GetProfile(profiles, name, units, &error);
+    Check(error, "Error getting host profile");
+    std::vector<double> edge_values = Resample(native_edge_values, grid_edges.size());
+    std::vector<double> midpoint_values = Midpoints(edge_values);
+    SetProfileEdgeValues(profile, edge_values.data(), edge_values.size(), &error);
+    Check(error, "Error setting host profile edge values");
+    SetProfileMidpointValues(profile, midpoint_values.data(), midpoint_values.size(), &error);
+    Check(error, "Error setting host profile midpoint values");
+    if (with_layer_densities)
+    {
+      std::vector<double> layer_densities(midpoint_values.size());
+      for (std::size_t i = 0; i < layer_densities.size(); ++i)
+        layer_densities[i] = midpoint_values[i] * (grid_edges[i + 1] - grid_edges[i]) * KM_TO_CM;
+      SetProfileLayerDensities(profile, layer_densities.data(), layer_densities.size(), &error);
+      Check(error, "Error setting host profile layer densities");
+      SetProfileExoLayerDensity(profile, edge_values.back() * EXO_SCALE_HEIGHT * KM_TO_CM, &error);
+      Check(error, "Error setting host profile exo layer density");
+    }
+    DeleteProfile(profile, &error);
+    DeleteError(&error);
+  }
+
+  void WriteTiming(std::ostream& out, const Timing& timing)
+  {
+    out << "{ \"min\": " << timing.min << ", \"mean\": " << timing.mean << ", \"max\": " << timing.max << " }";
+  }
+
+  void Benchmark(const Setup& setup, const Size& size, std::ostream& out)
+  {
+    Error error;
+    const std::string config = ResizeConfig(setup, size);
+    const std::vector<double> height_edges = Linspace(BOTTOM_HEIGHT, TOP_HEIGHT, size.layers + 1);
+    const std::vector<double> wavelength_edges = Linspace(MIN_WAVELENGTH, MAX_WAVELENGTH, size.wavelengths + 1);
+
+    GridMap* grids = CreateGridMap(&error);
+    Check(error, "Error creating grid map");
+    ProfileMap* profiles = CreateProfileMap(&error);
+    Check(error, "Error creating profile map");
+    RadiatorMap* radiators = CreateRadiatorMap(&error);
+    Check(error, "Error creating radiator map");
+    if (setup.host_data != HostData::None)
+    {
+      AddHostGrid(grids, "height", "km", height_edges);
+      AddHostGrid(grids, "wavelength", "nm", wavelength_edges);
+      AddHostProfile(grids, profiles, "temperature", "K", "height");
+    }
+    if (setup.host_data == HostData::All)
+    {
+      AddHostProfile(grids, profiles, "air", "molecule cm-3", "height");
+      AddHostProfile(grids, profiles, "O2", "molecule cm-3", "height");
+      AddHostProfile(grids, profiles, "surface albedo", "none", "wavelength");
+      AddHostProfile(grids, profiles, "extraterrestrial flux", "photon cm-2 s-1", "wavelength");
+    }
+
+    const Timing create_timing = Time(
+        CREATE_ITERATIONS,
+        [&]()
+        {
+          TUVX tuvx;
+          tuvx.CreateFromConfigString(config.c_str(), grids, profiles, radiators, &error);
+          Check(error, std::string("Error creating TUV-x for ") + setup.name);
+        });
+
+    TUVX tuvx;
+    tuvx.CreateFromConfigString(config.c_str(), grids, profiles, radiators, &error);
+    Check(error, std::string("Error creating TUV-x for ") + setup.name);
+    if (setup.host_data != HostData::None)
+    {
+      ProfileMap* tuvx_profiles = tuvx.GetProfileMap(&error);
+      Check(error, "Error getting TUV-x profile map");
+      SetHostProfile(tuvx_profiles, "temperature", "K", { 300.0, 275.0, 260.0, 255.0 }, height_edges, false);
+      if (setup.host_data == HostData::All)
+      {
+        SetHostProfile(tuvx_profiles, "air", "molecule cm-3", { 2.0e19, 1.8e19, 1.6e19, 1.2e19 }, height_edges, true);
+        SetHostProfile(tuvx_profiles, "O2", "molecule cm-3", { 5.0e17, 4.5e17, 4.0e17, 2.3e17 }, height_edges, true);
+        SetHostProfile(tuvx_profiles, "surface albedo", "none", { 0.1, 0.1 }, wavelength_edges, false);
+        SetHostProfile(
+            tuvx_profiles,
+            "extraterrestrial flux",
+            "photon cm-2 s-1",
+            { 1.2e14, 1.3e14, 1.4e14, 1.5e14, 1.6e14, 1.7e14 },
+            wavelength_edges,
+            false);
+      }
+      DeleteProfileMap(tuvx_profiles, &error);
+    }
+
+    const std::size_t number_of_edges = static_cast<std::size_t>(tuvx.GetNumberOfHeightMidpoints()) + 1;
+    const std::size_t number_of_wavelengths = static_cast<std::size_t>(tuvx.GetNumberOfWavelengthMidpoints());
+    const std::size_t photolysis_size = static_cast<std::size_t>(tuvx.GetPhotolysisRateConstantCount()) * number_of_edges;
+    const std::size_t heating_size = static_cast<std::size_t>(tuvx.GetHeatingRateCount()) * number_of_edges;
+    const std::size_t dose_size = static_cast<std::size_t>(tuvx.GetDoseRateCount()) * number_of_edges;
+    const std::size_t spectral_size = number_of_wavelengths * number_of_edges * 3;
+    std::vector<double> photolysis_rate_constants(photolysis_size);
+    std::vector<double> heating_rates(heating_size);
+    std::vector<double> dose_rates(dose_size);
+    std::vector<double> actinic_flux(spectral_size);
+    std::vector<double> spectral_irradiance(spectral_size);
+
+    out << "    {\n"
+        << "      \"setup\": \"" << setup.name << "\",\n"
+        << "      \"height_layers\": " << number_of_edges - 1 << ",\n"
+        << "      \"wavelength_bins\": " << number_of_wavelengths << ",\n"
+        << "      \"photolysis_reactions\": " << tuvx.GetPhotolysisRateConstantCount() << ",\n"
+        << "      \"heating_rates\": " << tuvx.GetHeatingRateCount() << ",\n"
+        << "      \"dose_rates\": " << tuvx.GetDoseRateCount() << ",\n"
+        << "      \"create_us\": ";
+    WriteTiming(out, create_timing);
+    out << ",\n      \"run\": [\n";
+    for (std::size_t i_set = 0; i_set < std::size(output_sets); ++i_set)
+    {
+      const OutputSet& output_set = output_sets[i_set];
+      auto buffer = [&output_set](unsigned int output, std::vector<double>& values)
+      { return (output_set.outputs & output) ? values.data() : nullptr; };
+      auto buffer_size = [&output_set](unsigned int output, std::size_t values_size)
+      { return (output_set.outputs & output) ? values_size : 0; };
+      const std::size_t output_values = buffer_size(TuvxOutput::PHOTOLYSIS_RATE_CONSTANTS, photolysis_size) +
+                                        buffer_size(TuvxOutput::HEATING_RATES, heating_size) +
+                                        buffer_size(TuvxOutput::DOSE_RATES, dose_size) +
+                                        buffer_size(TuvxOutput::ACTINIC_FLUX, spectral_size) +
+                                        buffer_size(TuvxOutput::SPECTRAL_IRRADIANCE, spectral_size);
+      const Timing run_timing = Time(
+          RUN_ITERATIONS,
+          [&]()
+          {
+            NoError(&error);
+            tuvx.Run(
+                SOLAR_ZENITH_ANGLE,
+                EARTH_SUN_DISTANCE,
+                buffer(TuvxOutput::PHOTOLYSIS_RATE_CONSTANTS, photolysis_rate_constants),
+                buffer(TuvxOutput::HEATING_RATES, heating_rates),
+                buffer(TuvxOutput::DOSE_RATES, dose_rates),
+                buffer(TuvxOutput::ACTINIC_FLUX, actinic_flux),
+                buffer(TuvxOutput::SPECTRAL_IRRADIANCE, spectral_irradiance),
+                &error);
+            Check(error, std::string("Error running TUV-x for ") + setup.name);
+          });
+      out << "        { \"outputs\": \"" << output_set.name << "\", \"output_bytes\": " << output_values * sizeof(double)
+          << ", \"run_us\": ";
+      WriteTiming(out, run_timing);
+      out << " }" << (i_set + 1 < std::size(output_sets) ? "," : "") << "\n";
+    }
+    out << "      ]\n    }";
+
+    DeleteGridMap(grids, &error);
+    DeleteProfileMap(profiles, &error);
+    DeleteRadiatorMap(radiators, &error);
+    DeleteError(&error);
+  }
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  std::ofstream file;
+  if (argc > 1)
+  {
+    file.open(argv[1]);
+    if (!file)
+    {
+      std::cerr << "Unable to open " << argv[1] << " for writing" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  std::ostream& out = argc > 1 ? file : std::cout;
+
+  out << "{\n"
+      << "  \"tuvx_version\": \"" << TUVX::GetVersion() << "\",\n"
+      << "  \"create_iterations\": " << CREATE_ITERATIONS << ",\n"
+      << "  \"run_iterations\": " << RUN_ITERATIONS << ",\n"
+      << "  \"solar_zenith_angle\": " << SOLAR_ZENITH_ANGLE << ",\n"
+      << "  \"results\": [\n";
+  bool first = true;
+  for (const Setup& setup : setups)
+  {
+    for (const Size& size : sizes)
+    {
+      out << (first ? "" : ",\n");
+      Benchmark(setup, size, out);
+      first = false;
+    }
+  }
+  out << "\n  ]\n}\n";
+  return EXIT_SUCCESS;
+}
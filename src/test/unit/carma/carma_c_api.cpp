@@ -1,9 +1,15 @@
 #include <musica/carma/carma.hpp>
 #include <musica/carma/carma_c_interface.hpp>
+#include <musica/carma/carma_column_batch.hpp>
 #include <musica/carma/carma_state.hpp>
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
 using namespace musica;
 
 class CarmaCApiTest : public ::testing::Test
@@ -207,6 +213,93 @@ TEST_F(CarmaCApiTest, CreateWithAluminumTestParams)
   EXPECT_EQ(params.number_of_refractive_indices, 1);
 }
 
+TEST_F(CarmaCApiTest, CCompatibleParametersMatchParameters)
+{
+  CARMAParameters params = CARMA::CreateAluminumTestParams();
+  params.groups[0].df = { 1.5, 2.5, 3.5 };
+  params.elements[0].refidx = { { { 1.0, 2.0 }, { 3.0, 4.0 } }, { { 5.0, 6.0 }, { 7.0, 8.0 } } };
+  CARMAGasConfig gas;
+  gas.name = "water";
+  gas.shortname = "H2O";
+  gas.refidx = { { { 9.0, 10.0 } } };
+  params.gases.push_back(gas);
+
+  CCARMAParameters* c_params = CARMA::ToCCompatible(params);
+  ASSERT_NE(c_params, nullptr);
+  EXPECT_EQ(c_params->nbin, params.nbin);
+  EXPECT_EQ(c_params->nz, params.nz);
+  EXPECT_EQ(c_params->groups_size, static_cast<int>(params.groups.size()));
+  ASSERT_EQ(c_params->groups[0].df_size, 3);
+  EXPECT_EQ(c_params->groups[0].df[2], 3.5);
+  ASSERT_EQ(c_params->elements[0].refidx_dim_1_size, 2);
+  ASSERT_EQ(c_params->elements[0].refidx_dim_2_size, 2);
+  EXPECT_EQ(c_params->elements[0].refidx[3].real, 7.0);
+  EXPECT_EQ(c_params->elements[0].refidx[3].imaginary, 8.0);
+  ASSERT_EQ(c_params->gases_size, static_cast<int>(params.gases.size()));
+  const auto& c_gas = c_params->gases[c_params->gases_size - 1];
+  EXPECT_STREQ(c_gas.name, "water");
+  EXPECT_STREQ(c_gas.shortname, "H2O");
+  EXPECT_EQ(c_gas.refidx[0].imaginary, 10.0);
+  EXPECT_EQ(c_params->solutes_size, static_cast<int>(params.solutes.size()));
+  EXPECT_EQ(c_params->initialization.maxretries, params.initialization.maxretries);
+  CARMA::FreeCCompatible(c_params);
+}
+
+TEST_F(CarmaCApiTest, EqualParametersShareCarmaInstance)
+{
+  CARMAParameters params = CARMA::CreateAluminumTestParams();
+  std::size_t const initial_instances = CARMA::NumberOfCachedInstances();
+  {
+    CARMA const first{ params };
+    CARMA const second{ params };
+    EXPECT_EQ(first.GetCarmaInstance(), second.GetCarmaInstance());
+    EXPECT_EQ(first.GetCParameters(), second.GetCParameters());
+    EXPECT_EQ(CARMA::NumberOfCachedInstances(), initial_instances + 1);
+
+    CARMAGroupProperties const first_props = first.GetGroupProperties(1);
+    CARMAGroupProperties const second_props = second.GetGroupProperties(1);
+    EXPECT_EQ(first_props.bin_radius, second_props.bin_radius);
+    EXPECT_EQ(first_props.bin_mass, second_props.bin_mass);
+
+    params.groups[0].rmrat *= 1.5;
+    CARMA const different{ params };
+    EXPECT_NE(first.GetCarmaInstance(), different.GetCarmaInstance());
+    EXPECT_EQ(CARMA::NumberOfCachedInstances(), initial_instances + 2);
+
+    // every field takes part in the comparison, including those in nested configurations
+    params.initialization.tstick *= 0.5;
+    CARMA const different_initialization{ params };
+    EXPECT_NE(different.GetCarmaInstance(), different_initialization.GetCarmaInstance());
+    EXPECT_EQ(CARMA::NumberOfCachedInstances(), initial_instances + 3);
+  }
+  EXPECT_EQ(CARMA::NumberOfCachedInstances(), initial_instances);
+}
+
+TEST_F(CarmaCApiTest, ConcurrentConstructionSharesCarmaInstance)
+{
+  CARMAParameters const params = CARMA::CreateAluminumTestParams();
+  std::size_t const initial_instances = CARMA::NumberOfCachedInstances();
+  {
+    std::vector<std::unique_ptr<CARMA>> instances(4);
+    std::vector<std::thread> threads;
+    for (auto& instance : instances)
+    {
+      threads.emplace_back([&instance, &params]() { instance = std::make_unique<CARMA>(params); });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+    for (const auto& instance : instances)
+    {
+      ASSERT_NE(instance, nullptr);
+      EXPECT_EQ(instance->GetCarmaInstance(), instances[0]->GetCarmaInstance());
+    }
+    EXPECT_EQ(CARMA::NumberOfCachedInstances(), initial_instances + 1);
+  }
+  EXPECT_EQ(CARMA::NumberOfCachedInstances(), initial_instances);
+}
+
 TEST_F(CarmaCApiTest, CanSetBinValues)
 {
   CARMAParameters params = CARMA::CreateAluminumTestParams();
@@ -255,4 +348,282 @@ TEST_F(CarmaCApiTest, CanSetBinValues)
 
   CARMAGroupProperties const group_props = carma.GetGroupProperties(1);
   CARMAElementProperties const element_props = carma.GetElementProperties(1);
-}
\ No newline at end of file
+}
+
+TEST_F(CarmaCApiTest, BulkBinsAndGasesMatchPerBinValues)
+{
+  CARMAParameters params = CARMA::CreateAluminumTestParams();
+  CARMAGasConfig gas_config;
+  gas_config.name = "Water";
+  gas_config.shortname = "H2O";
+  gas_config.wtmol = 0.018;
+  gas_config.ivaprtn = VaporizationAlgorithm::H2O_BUCK_1981;
+  gas_config.icomposition = GasComposition::H2O;
+  params.gases.push_back(gas_config);
+  CARMA const carma{ params };
+
+  CARMAStateParameters state_params;
+  state_params.time_step = params.dtime;
+  state_params.temperature = std::vector<double>(params.nz, 250.0);
+  state_params.pressure = std::vector<double>(params.nz, 90000.0);
+  state_params.pressure_levels = std::vector<double>(params.nz + 1, 101325.0);
+  state_params.vertical_levels = std::vector<double>(params.nz + 1, 1.0);
+  state_params.vertical_center = std::vector<double>(params.nz, 16500.0);
+  CARMAState state{ carma, state_params };
+
+  std::size_t const nz = params.nz;
+  std::size_t const nbin = params.nbin;
+  std::size_t const nelem = params.elements.size();
+  std::size_t const ngas = params.gases.size();
+
+  std::vector<double> bin_values(nelem * nbin * nz);
+  std::vector<double> surface_mass(nelem * nbin, 0.0);
+  for (std::size_t i = 0; i < bin_values.size(); ++i)
+    bin_values[i] = 1.0e-10 * (i + 1);
+  ASSERT_NO_THROW(state.SetBins(bin_values.data(), surface_mass.data()));
+  std::vector<double> gas_values(ngas * nz, 1.4e-3);
+  ASSERT_NO_THROW(state.SetGases(gas_values.data()));
+
+  CARMAStateStepConfig step_config;
+  ASSERT_NO_THROW(state.Step(step_config));
+
+  std::size_t const n_profile_fields = static_cast<std::size_t>(CarmaBinProfileField::NUMBER_OF_FIELDS);
+  std::size_t const n_surface_fields = static_cast<std::size_t>(CarmaBinSurfaceField::NUMBER_OF_FIELDS);
+  std::size_t const n_gas_fields = static_cast<std::size_t>(CarmaGasField::NUMBER_OF_FIELDS);
+  std::vector<double> profiles(n_profile_fields * nelem * nbin * nz);
+  std::vector<double> fall_velocity(nelem * nbin * (nz + 1));
+  std::vector<double> surface_values(n_surface_fields * nelem * nbin);
+  std::vector<double> gases(n_gas_fields * ngas * nz);
+  ASSERT_NO_THROW(state.GetBins(profiles.data(), fall_velocity.data(), surface_values.data()));
+  ASSERT_NO_THROW(state.GetGases(gases.data()));
+
+  auto profile = [&](CarmaBinProfileField field, std::size_t i_elem, std::size_t i_bin, std::size_t i_level)
+  { return profiles[((static_cast<std::size_t>(field) * nelem + i_elem) * nbin + i_bin) * nz + i_level]; };
+  auto surface = [&](CarmaBinSurfaceField field, std::size_t i_elem, std::size_t i_bin)
+  { return surface_values[(static_cast<std::size_t>(field) * nelem + i_elem) * nbin + i_bin]; };
+
+  for (std::size_t i_elem = 0; i_elem < nelem; ++i_elem)
+  {
+    for (std::size_t i_bin = 0; i_bin < nbin; ++i_bin)
+    {
+      CarmaBinValues const values = state.GetBinValues(i_bin + 1, i_elem + 1);
+      for (std::size_t i_level = 0; i_level < nz; ++i_level)
+      {
+        EXPECT_EQ(
+            profile(CarmaBinProfileField::MASS_MIXING_RATIO, i_elem, i_bin, i_level), values.mass_mixing_ratio[i_level]);
+        EXPECT_EQ(profile(CarmaBinProfileField::NUMBER_DENSITY, i_elem, i_bin, i_level), values.number_density[i_level]);
+        EXPECT_EQ(
+            profile(CarmaBinProfileField::WET_PARTICLE_RADIUS, i_elem, i_bin, i_level), values.wet_particle_radius[i_level]);
+        EXPECT_EQ(profile(CarmaBinProfileField::KAPPA, i_elem, i_bin, i_level), values.kappa[i_level]);
+        EXPECT_EQ(
+            profile(CarmaBinProfileField::TOTAL_MASS_MIXING_RATIO, i_elem, i_bin, i_level),
+            values.total_mass_mixing_ratio[i_level]);
+      }
+      for (std::size_t i_level = 0; i_level < nz + 1; ++i_level)
+      {
+        EXPECT_EQ(fall_velocity[(i_elem * nbin + i_bin) * (nz + 1) + i_level], values.fall_velocity[i_level]);
+      }
+      EXPECT_EQ(surface(CarmaBinSurfaceField::PARTICLE_MASS_ON_SURFACE, i_elem, i_bin), values.particle_mass_on_surface);
+      EXPECT_EQ(surface(CarmaBinSurfaceField::SEDIMENTATION_FLUX, i_elem, i_bin), values.sedimentation_flux);
+      EXPECT_EQ(surface(CarmaBinSurfaceField::DEPOSITION_VELOCITY, i_elem, i_bin), values.deposition_velocity);
+    }
+  }
+
+  for (std::size_t i_gas = 0; i_gas < ngas; ++i_gas)
+  {
+    CarmaGasValues const values = state.GetGas(i_gas + 1);
+    for (std::size_t i_level = 0; i_level < nz; ++i_level)
+    {
+      std::size_t const offset = i_gas * nz + i_level;
+      EXPECT_EQ(gases[offset], values.mass_mixing_ratio[i_level]);
+      EXPECT_EQ(
+          gases[static_cast<std::size_t>(CarmaGasField::GAS_SATURATION_WRT_ICE) * ngas * nz + offset],
+          values.gas_saturation_wrt_ice[i_level]);
+      EXPECT_EQ(
+          gases[static_cast<std::size_t>(CarmaGasField::GAS_VAPOR_PRESSURE_WRT_LIQUID) * ngas * nz + offset],
+          values.gas_vapor_pressure_wrt_liquid[i_level]);
+    }
+  }
+
+  EXPECT_THROW(state.SetBins(nullptr, surface_mass.data()), std::invalid_argument);
+  EXPECT_THROW(state.GetGases(nullptr), std::invalid_argument);
+}
+
+TEST_F(CarmaCApiTest, TimingCollectsStepTimes)
+{
+  CARMAParameters const params = CARMA::CreateAluminumTestParams();
+  CARMA const carma{ params };
+
+  CARMAStateParameters state_params;
+  state_params.time_step = params.dtime;
+  state_params.temperature = std::vector<double>(params.nz, 250.0);
+  state_params.pressure = std::vector<double>(params.nz, 90000.0);
+  state_params.pressure_levels = std::vector<double>(params.nz + 1, 101325.0);
+  state_params.vertical_levels = std::vector<double>(params.nz + 1, 1.0);
+  state_params.vertical_center = std::vector<double>(params.nz, 16500.0);
+  CARMAState state{ carma, state_params };
+  state.SetBin(1, 1, std::vector<double>(params.nz, 1.0e-9), 0.0);
+
+  CARMAStateStepConfig step_config;
+  state.Step(step_config);
+  CarmaStatistics stats = state.GetStepStatistics();
+  EXPECT_FALSE(stats.timing.enabled);
+  EXPECT_EQ(stats.timing.number_of_steps, 0);
+  EXPECT_EQ(stats.timing.step_time, 0.0);
+
+  auto take_steps = [&](int number_of_steps)
+  {
+    for (int i_step = 0; i_step < number_of_steps; ++i_step)
+    {
+      state.SetBin(1, 1, std::vector<double>(params.nz, 1.0e-9), 0.0);
+      state.Step(step_config);
+      state.GetBinValues(1, 1);
+    }
+  };
+
+  state.EnableTiming(true);
+  take_steps(3);
+  stats = state.GetStepStatistics();
+  EXPECT_TRUE(stats.timing.enabled);
+  EXPECT_EQ(stats.timing.number_of_steps, 3);
+  EXPECT_GT(stats.timing.max_step_time, 0.0);
+  EXPECT_LE(stats.timing.max_step_time, stats.timing.step_time);
+  EXPECT_GT(stats.timing.set_time, 0.0);
+  EXPECT_GT(stats.timing.get_time, 0.0);
+  double const step_time_before_reset = stats.timing.step_time;
+
+  // steps taken with timing disabled are not counted
+  state.EnableTiming(false);
+  take_steps(1);
+  stats = state.GetStepStatistics();
+  EXPECT_EQ(stats.timing.number_of_steps, 3);
+  EXPECT_EQ(stats.timing.step_time, step_time_before_reset);
+
+  state.EnableTiming(true);
+  state.ResetTiming();
+  stats = state.GetStepStatistics();
+  EXPECT_TRUE(stats.timing.enabled);
+  EXPECT_EQ(stats.timing.number_of_steps, 0);
+  EXPECT_EQ(stats.timing.step_time, 0.0);
+  EXPECT_EQ(stats.timing.max_step_time, 0.0);
+
+  // timers start again from zero after a reset
+  take_steps(2);
+  stats = state.GetStepStatistics();
+  EXPECT_EQ(stats.timing.number_of_steps, 2);
+  EXPECT_GT(stats.timing.max_step_time, 0.0);
+  EXPECT_LE(stats.timing.max_step_time, stats.timing.step_time);
+}
+
+TEST_F(CarmaCApiTest, ResetMatchesNewState)
+{
+  CARMAParameters const params = CARMA::CreateAluminumTestParams();
+  CARMA const carma{ params };
+
+  auto column_params = [&](double temperature, double longitude)
+  {
+    CARMAStateParameters state_params;
+    state_params.longitude = longitude;
+    state_params.time_step = params.dtime;
+    state_params.temperature = std::vector<double>(params.nz, temperature);
+    state_params.pressure = std::vector<double>(params.nz, 90000.0);
+    state_params.pressure_levels = std::vector<double>(params.nz + 1, 101325.0);
+    state_params.vertical_levels = std::vector<double>(params.nz + 1, 1.0);
+    state_params.vertical_center = std::vector<double>(params.nz, 16500.0);
+    return state_params;
+  };
+  CARMAStateParameters const first_column = column_params(250.0, 0.0);
+  CARMAStateParameters const second_column = column_params(280.0, 45.0);
+
+  CARMAStateStepConfig step_config;
+  step_config.cloud_fraction = std::vector<double>(params.nz, 0.2);
+  step_config.critical_relative_humidity = std::vector<double>(params.nz, 0.8);
+
+  CARMAState state{ carma, first_column };
+  state.SetBin(1, 1, std::vector<double>(params.nz, 5.0e-9), 0.0);
+  ASSERT_NO_THROW(state.Step(step_config));
+
+  ASSERT_NO_THROW(state.Reset(second_column));
+  EXPECT_EQ(state.GetEnvironmentalValues().temperature, second_column.temperature);
+  state.SetBin(1, 1, std::vector<double>(params.nz, 1.0e-9), 0.0);
+  ASSERT_NO_THROW(state.Step(step_config));
+
+  CARMAState new_state{ carma, second_column };
+  new_state.SetBin(1, 1, std::vector<double>(params.nz, 1.0e-9), 0.0);
+  ASSERT_NO_THROW(new_state.Step(step_config));
+
+  CarmaBinValues const expected = new_state.GetBinValues(1, 1);
+  CarmaBinValues const actual = state.GetBinValues(1, 1);
+  ASSERT_EQ(actual.mass_mixing_ratio.size(), expected.mass_mixing_ratio.size());
+  for (std::size_t i_level = 0; i_level < expected.mass_mixing_ratio.size(); ++i_level)
+  {
+    EXPECT_DOUBLE_EQ(actual.mass_mixing_ratio[i_level], expected.mass_mixing_ratio[i_level]);
+  }
+  EXPECT_EQ(state.GetEnvironmentalValues().temperature, new_state.GetEnvironmentalValues().temperature);
+
+  CARMAStateParameters bad_column = second_column;
+  bad_column.temperature.push_back(300.0);
+  EXPECT_THROW(state.Reset(bad_column), std::invalid_argument);
+}
+
+TEST_F(CarmaCApiTest, ColumnBatchMatchesSerialColumns)
+{
+  CARMAParameters const params = CARMA::CreateAluminumTestParams();
+  CARMA const carma{ params };
+
+  std::size_t const number_of_columns = 5;
+  std::vector<CARMAStateParameters> column_params(number_of_columns);
+  for (std::size_t i_column = 0; i_column < number_of_columns; ++i_column)
+  {
+    auto& state_params = column_params[i_column];
+    state_params.longitude = 10.0 * i_column;
+    state_params.latitude = 5.0 * i_column;
+    state_params.temperature = std::vector<double>(params.nz, 250.0 + 5.0 * i_column);
+    state_params.pressure = std::vector<double>(params.nz, 101325.0);
+    state_params.pressure_levels = std::vector<double>(params.nz + 1, 101325.0);
+    state_params.vertical_levels = std::vector<double>(params.nz + 1, 1.0);
+    state_params.vertical_center = std::vector<double>(params.nz, 16500.0);
+  }
+
+  std::vector<CARMAStateStepConfig> step_configs(number_of_columns);
+  for (std::size_t i_column = 0; i_column < number_of_columns; ++i_column)
+  {
+    step_configs[i_column].cloud_fraction = std::vector<double>(params.nz, 0.1 * i_column);
+    step_configs[i_column].critical_relative_humidity = std::vector<double>(params.nz, 0.8);
+  }
+
+  CARMAColumnBatch batch{ carma, column_params, 2 };
+  EXPECT_EQ(batch.NumberOfColumns(), number_of_columns);
+  EXPECT_EQ(batch.NumberOfThreads(), 2);
+  for (std::size_t i_column = 0; i_column < number_of_columns; ++i_column)
+  {
+    ASSERT_NO_THROW(batch.GetColumn(i_column).SetBin(1, 1, std::vector<double>(params.nz, 1.0e-9 * (i_column + 1)), 0.0));
+  }
+  ASSERT_NO_THROW(batch.Step(step_configs));
+  std::vector<CarmaStatistics> const batch_stats = batch.GetStepStatistics();
+  ASSERT_EQ(batch_stats.size(), number_of_columns);
+
+  for (std::size_t i_column = 0; i_column < number_of_columns; ++i_column)
+  {
+    CARMAState state{ carma, column_params[i_column] };
+    state.SetBin(1, 1, std::vector<double>(params.nz, 1.0e-9 * (i_column + 1)), 0.0);
+    state.Step(step_configs[i_column]);
+    CarmaStatistics const stats = state.GetStepStatistics();
+    EXPECT_EQ(batch_stats[i_column].max_number_of_substeps, stats.max_number_of_substeps);
+    EXPECT_EQ(batch_stats[i_column].total_number_of_substeps, stats.total_number_of_substeps);
+    EXPECT_EQ(batch_stats[i_column].z_substeps, stats.z_substeps);
+
+    CarmaBinValues const expected = state.GetBinValues(1, 1);
+    CarmaBinValues const actual = batch.GetColumn(i_column).GetBinValues(1, 1);
+    ASSERT_EQ(actual.mass_mixing_ratio.size(), expected.mass_mixing_ratio.size());
+    for (std::size_t i_level = 0; i_level < expected.mass_mixing_ratio.size(); ++i_level)
+    {
+      EXPECT_DOUBLE_EQ(actual.mass_mixing_ratio[i_level], expected.mass_mixing_ratio[i_level]);
+    }
+  }
+
+  std::vector<CARMAStateStepConfig> too_few_configs(number_of_columns - 1);
+  EXPECT_THROW(batch.Step(too_few_configs), std::invalid_argument);
+  EXPECT_THROW(batch.GetColumn(number_of_columns), std::out_of_range);
+  EXPECT_THROW(CARMAColumnBatch(carma, {}), std::invalid_argument);
+}
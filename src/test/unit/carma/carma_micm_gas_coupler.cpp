@@ -0,0 +1,109 @@
+#include <musica/carma/carma.hpp>
+#include <musica/carma/carma_micm_gas_coupler.hpp>
+#include <musica/carma/carma_state.hpp>
+#include <musica/configuration/parse.hpp>
+#include <musica/configuration/read_mechanism.hpp>
+#include <musica/micm/micm.hpp>
+#include <musica/micm/state.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace musica;
+
+namespace
+{
+  CARMAParameters CoupledParameters()
+  {
+    CARMAParameters params = CARMA::CreateAluminumTestParams();
+    params.nz = 3;
+    CARMAGasConfig gas_config;
+    gas_config.name = "Water";
+    gas_config.shortname = "H2O";
+    gas_config.wtmol = 0.018;
+    gas_config.ivaprtn = VaporizationAlgorithm::H2O_BUCK_1981;
+    gas_config.icomposition = GasComposition::H2O;
+    params.gases.push_back(gas_config);
+    return params;
+  }
+
+  CARMAStateParameters ColumnParameters(const CARMAParameters& params)
+  {
+    CARMAStateParameters state_params;
+    state_params.time_step = params.dtime;
+    state_params.temperature = std::vector<double>(params.nz, 250.0);
+    state_params.pressure = std::vector<double>(params.nz, 90000.0);
+    state_params.pressure_levels = std::vector<double>(params.nz + 1, 101325.0);
+    state_params.vertical_levels = std::vector<double>(params.nz + 1, 1.0);
+    state_params.vertical_center = std::vector<double>(params.nz, 16500.0);
+    return state_params;
+  }
+
+  void ExchangeGases(MICMSolver solver_type)
+  {
+    CARMAParameters const params = CoupledParameters();
+    CARMA const carma{ params };
+    CARMAState carma_state{ carma, ColumnParameters(params) };
+    std::vector<double> const air_density = { 1.2, 0.9, 0.6 };
+    carma_state.SetAirDensity(air_density);
+
+    // the CARMA water vapor is linked to the Chapman ozone to exercise the exchange
+    MICM micm{ ConvertChemistry(ReadMechanism("configs/v0/chapman")), solver_type };
+    std::size_t const first_grid_cell = 1;
+    State micm_state{ micm, params.nz + first_grid_cell + 1 };
+    std::vector<double> const ozone = { 5.0e-3, 1.0e-3, 2.0e-3, 3.0e-3, 7.0e-3 };
+    micm_state.SetConcentrations({ { "O3", ozone } }, solver_type);
+
+    CARMAMICMGasCoupler coupler{ carma, micm, std::map<GasComposition, std::string>{ { GasComposition::H2O, "O3" } } };
+    ASSERT_EQ(coupler.NumberOfLinks(), 1u);
+
+    coupler.MICMToCARMA(micm_state, first_grid_cell, carma_state);
+    CarmaGasValues const gas = carma_state.GetGas(1);
+    for (int k = 0; k < params.nz; ++k)
+    {
+      EXPECT_NEAR(gas.mass_mixing_ratio[k], ozone[first_grid_cell + k] * 0.018 / air_density[k], 1.0e-15);
+    }
+
+    std::vector<double> const water = { 4.0e-6, 5.0e-6, 6.0e-6 };
+    carma_state.SetGases(water.data());
+    coupler.CARMAToMICM(carma_state, micm_state, first_grid_cell);
+    std::map<std::string, std::vector<double>> const concentrations = micm_state.GetConcentrations(solver_type);
+    const auto& updated_ozone = concentrations.at("O3");
+    EXPECT_EQ(updated_ozone[0], ozone[0]);
+    for (int k = 0; k < params.nz; ++k)
+    {
+      EXPECT_NEAR(updated_ozone[first_grid_cell + k], water[k] * air_density[k] / 0.018, 1.0e-12);
+    }
+    EXPECT_EQ(updated_ozone[first_grid_cell + params.nz], ozone[first_grid_cell + params.nz]);
+
+    EXPECT_THROW(coupler.CARMAToMICM(carma_state, micm_state, 3), std::out_of_range);
+  }
+}  // namespace
+
+TEST(CARMAMICMGasCoupler, ExchangesVectorOrderedConcentrations)
+{
+  ExchangeGases(MICMSolver::Rosenbrock);
+}
+
+TEST(CARMAMICMGasCoupler, ExchangesStandardOrderedConcentrations)
+{
+  ExchangeGases(MICMSolver::RosenbrockStandardOrder);
+}
+
+TEST(CARMAMICMGasCoupler, RejectsUnknownGasesAndSpecies)
+{
+  CARMAParameters const params = CoupledParameters();
+  CARMA const carma{ params };
+  MICM micm{ ConvertChemistry(ReadMechanism("configs/v0/chapman")), MICMSolver::Rosenbrock };
+
+  EXPECT_THROW(
+      CARMAMICMGasCoupler(carma, micm, std::vector<CARMAMICMGasLink>{ { "Sulfate", "O3" } }), std::invalid_argument);
+  EXPECT_THROW(
+      CARMAMICMGasCoupler(carma, micm, std::vector<CARMAMICMGasLink>{ { "Water", "H2O" } }), std::invalid_argument);
+  EXPECT_THROW(
+      CARMAMICMGasCoupler(carma, micm, std::map<GasComposition, std::string>{ { GasComposition::SO2, "O3" } }),
+      std::invalid_argument);
+}
@@ -41,3 +41,23 @@ TEST(OneParseManyConverters, EmissionsConfigFeedsBothConvertersToo)
   EXPECT_EQ(chemistry.system.gas_phase_.phase_species_.size(), 0);
   EXPECT_EQ(emissions.sources.size(), 2);
 }
+
+TEST(OneParseManyConverters, ChemistryTablesShareTheConvertedSpeciesAndPhases)
+{
+  mechanism_configuration::Mechanism mechanism = musica::ReadMechanism("configs/v1/chapman/config.json");
+
+  musica::ChemistryTables tables;
+  musica::Chemistry chemistry = musica::ConvertChemistry(mechanism, tables);
+
+  EXPECT_EQ(tables.species.size(), mechanism.species.size());
+  ASSERT_EQ(tables.phases.size(), 1);
+  const micm::Phase& gas_phase = tables.phases.at("gas");
+  ASSERT_EQ(gas_phase.phase_species_.size(), chemistry.system.gas_phase_.phase_species_.size());
+  for (std::size_t i = 0; i < gas_phase.phase_species_.size(); ++i)
+  {
+    const std::string& name = gas_phase.phase_species_[i].species_.name_;
+    EXPECT_EQ(name, chemistry.system.gas_phase_.phase_species_[i].species_.name_);
+    EXPECT_EQ(tables.species.count(name), 1);
+  }
+  EXPECT_EQ(chemistry.processes.size(), musica::ConvertChemistry(mechanism).processes.size());
+}
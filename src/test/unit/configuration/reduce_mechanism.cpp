@@ -0,0 +1,104 @@
+// Copyright (C) 2023-2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Tests of the directed relation graph mechanism reduction pass.
+
+#include <musica/configuration/read_mechanism.hpp>
+#include <musica/configuration/reduce.hpp>
+#include <musica/utils/error.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+  musica::ReductionConditions ChapmanConditions(double n2_concentration)
+  {
+    musica::ReductionConditions conditions;
+    conditions.temperature = 227.0;
+    conditions.pressure = 1200.0;
+    conditions.air_density = conditions.pressure / (8.314 * conditions.temperature);
+    conditions.concentrations = { { "O1D", 1.0e-12 },
+                                  { "O", 1.0e-8 },
+                                  { "O2", 0.2 * conditions.air_density },
+                                  { "O3", 1.0e-6 },
+                                  { "N2", n2_concentration } };
+    conditions.rate_parameters = { { "PHOTO.jo2_b", 1.0e-10 }, { "PHOTO.jo3_a", 1.0e-3 }, { "PHOTO.jo3_b", 1.0e-3 } };
+    return conditions;
+  }
+}  // namespace
+
+TEST(ReduceMechanism, KeepsStronglyCoupledSpecies)
+{
+  mechanism_configuration::Mechanism mechanism = musica::ReadMechanism("configs/v1/chapman/config.json");
+  musica::ReductionConditions conditions = ChapmanConditions(0.0);
+  conditions.concentrations["N2"] = 0.8 * conditions.air_density;
+
+  musica::ReducedChemistry reduced =
+      musica::ReduceMechanism(mechanism, { .target_species = { "O3" }, .sample_conditions = { conditions } });
+
+  EXPECT_TRUE(reduced.removed_species.empty());
+  EXPECT_EQ(reduced.number_of_removed_reactions, 0);
+  EXPECT_EQ(reduced.chemistry.system.gas_phase_.phase_species_.size(), 6);
+  EXPECT_EQ(reduced.chemistry.processes.size(), 7);
+  EXPECT_EQ(reduced.error_estimate, 0.0);
+}
+
+TEST(ReduceMechanism, RemovesUncoupledSpeciesAndTheirReactions)
+{
+  mechanism_configuration::Mechanism mechanism = musica::ReadMechanism("configs/v1/chapman/config.json");
+
+  musica::ReducedChemistry reduced =
+      musica::ReduceMechanism(mechanism, { .target_species = { "O3" }, .sample_conditions = { ChapmanConditions(0.0) } });
+
+  ASSERT_EQ(reduced.removed_species.size(), 1);
+  EXPECT_EQ(reduced.removed_species[0], "N2");
+  EXPECT_EQ(reduced.number_of_removed_reactions, 1);
+  EXPECT_EQ(reduced.mechanism.species.size(), 5);
+  EXPECT_EQ(reduced.mechanism.reactions.arrhenius.size(), 3);
+  EXPECT_EQ(reduced.chemistry.system.gas_phase_.phase_species_.size(), 5);
+  EXPECT_EQ(reduced.chemistry.processes.size(), 6);
+  EXPECT_NEAR(reduced.error_estimate, 0.0, 1.0e-12);
+}
+
+TEST(ReduceMechanism, RetainsReactionsWithoutRateParameters)
+{
+  mechanism_configuration::Mechanism mechanism = musica::ReadMechanism("configs/v1/chapman/config.json");
+  musica::ReductionConditions conditions = ChapmanConditions(0.0);
+  conditions.rate_parameters.clear();
+
+  musica::ReducedChemistry reduced =
+      musica::ReduceMechanism(mechanism, { .target_species = { "O3" }, .sample_conditions = { conditions } });
+
+  EXPECT_EQ(reduced.mechanism.reactions.photolysis.size(), 3);
+  EXPECT_EQ(reduced.chemistry.processes.size(), 6);
+  EXPECT_EQ(std::count(reduced.removed_species.begin(), reduced.removed_species.end(), "N2"), 1);
+}
+
+TEST(ReduceMechanism, RetainsSurfaceReactions)
+{
+  mechanism_configuration::Mechanism mechanism = musica::ReadMechanism("configs/v1/chapman/config.json");
+  mechanism_configuration::types::Surface surface;
+  surface.name = "N2 uptake";
+  surface.gas_phase_species.name = "N2";
+  surface.reaction_probability = 1.0;
+  mechanism.reactions.surface.push_back(surface);
+
+  musica::ReducedChemistry reduced =
+      musica::ReduceMechanism(mechanism, { .target_species = { "O3" }, .sample_conditions = { ChapmanConditions(0.0) } });
+
+  EXPECT_EQ(reduced.mechanism.reactions.surface.size(), 1);
+  EXPECT_TRUE(reduced.removed_species.empty());
+}
+
+TEST(ReduceMechanism, UnknownTargetSpeciesThrows)
+{
+  mechanism_configuration::Mechanism mechanism = musica::ReadMechanism("configs/v1/chapman/config.json");
+
+  EXPECT_ANY_THROW(
+      musica::ReduceMechanism(mechanism, { .target_species = { "XYZ" }, .sample_conditions = { ChapmanConditions(0.0) } }));
+  EXPECT_THROW(
+      musica::ReduceMechanism(mechanism, { .sample_conditions = { ChapmanConditions(0.0) } }), std::invalid_argument);
+}
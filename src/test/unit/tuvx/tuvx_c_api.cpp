@@ -544,6 +544,74 @@ TEST_F(TuvxCApiTest, CanCreateProfileMap)
   DeleteError(&error);
 }
 
+TEST_F(TuvxCApiTest, ResolvedHandlesAreCached)
+{
+  Error error;
+  GridMap* grid_map = CreateGridMap(&error);
+  ASSERT_TRUE(IsSuccess(error));
+  ProfileMap* profile_map = CreateProfileMap(&error);
+  ASSERT_TRUE(IsSuccess(error));
+  RadiatorMap* radiator_map = CreateRadiatorMap(&error);
+  ASSERT_TRUE(IsSuccess(error));
+  Grid* height = CreateGrid("height", "km", 2, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  Grid* wavelength = CreateGrid("wavelength", "nm", 2, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  AddGrid(grid_map, height, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  Profile* temperature = CreateProfile("temperature", "K", height, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  AddProfile(profile_map, temperature, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  Radiator* aerosol = CreateRadiator("aerosol", height, wavelength, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  AddRadiator(radiator_map, aerosol, &error);
+  ASSERT_TRUE(IsSuccess(error));
+
+  Grid* resolved_height = ResolveGrid(grid_map, "height", "km", &error);
+  ASSERT_TRUE(IsSuccess(error));
+  ASSERT_NE(resolved_height, nullptr);
+  EXPECT_EQ(ResolveGrid(grid_map, "height", "km", &error), resolved_height);
+  ASSERT_TRUE(IsSuccess(error));
+  Profile* resolved_temperature = ResolveProfile(profile_map, "temperature", "K", &error);
+  ASSERT_TRUE(IsSuccess(error));
+  ASSERT_NE(resolved_temperature, nullptr);
+  EXPECT_EQ(ResolveProfile(profile_map, "temperature", "K", &error), resolved_temperature);
+  ASSERT_TRUE(IsSuccess(error));
+  Radiator* resolved_aerosol = ResolveRadiator(radiator_map, "aerosol", &error);
+  ASSERT_TRUE(IsSuccess(error));
+  ASSERT_NE(resolved_aerosol, nullptr);
+  EXPECT_EQ(ResolveRadiator(radiator_map, "aerosol", &error), resolved_aerosol);
+  ASSERT_TRUE(IsSuccess(error));
+
+  // values written through a resolved data pointer are seen by every other handle
+  double* temperature_midpoints = GetProfileMidpointValuesPointer(resolved_temperature, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  temperature_midpoints[0] = 280.0;
+  temperature_midpoints[1] = 270.0;
+  double midpoint_values[2] = { 0.0, 0.0 };
+  GetProfileMidpointValues(temperature, midpoint_values, 2, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  EXPECT_EQ(midpoint_values[0], 280.0);
+  EXPECT_EQ(midpoint_values[1], 270.0);
+
+  DeleteRadiator(aerosol, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  DeleteProfile(temperature, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  DeleteGrid(height, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  DeleteGrid(wavelength, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  DeleteRadiatorMap(radiator_map, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  DeleteProfileMap(profile_map, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  DeleteGridMap(grid_map, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  DeleteError(&error);
+}
+
 TEST_F(TuvxCApiTest, CannotGetConfiguredRadiator)
 {
   const char* yaml_config_path = "configs/tuvx/ts1_tsmlt_fixed.yml";
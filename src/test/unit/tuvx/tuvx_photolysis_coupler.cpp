@@ -0,0 +1,140 @@
+#include <musica/micm/micm.hpp>
+#include <musica/micm/state.hpp>
+#include <musica/tuvx/photolysis_coupler.hpp>
+#include <musica/tuvx/tuvx.hpp>
+#include <musica/tuvx/tuvx_c_interface.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace musica;
+
+// Photolysis rate constants from the fixed TUV-x configuration at a solar zenith angle
+// of 0.1 radians and an Earth-Sun distance of 1.1 AU (see tuvx_run_from_config.cpp)
+const double expected_photolysis_rate_constants[3][4] = {
+  { 8.91393763338872e-28, 1.64258192104497e-20, 8.48391527327371e-14, 9.87420948924703e-08 },
+  { 2.49575956372508e-27, 4.58686176250519e-20, 2.22679622672858e-13, 2.29392676897831e-07 },
+  { 1.78278752667774e-27, 3.28516384208994e-20, 1.69678305465474e-13, 1.97484189784941e-07 }
+};
+
+// The coupler must handle both vector-ordered and standard-ordered states
+const MICMSolver solver_types[] = { MICMSolver::Rosenbrock, MICMSolver::RosenbrockStandardOrder };
+
+class PhotolysisCouplerTest : public ::testing::Test
+{
+ protected:
+  GridMap* grids;
+  ProfileMap* profiles;
+  RadiatorMap* radiators;
+  TUVX* tuvx;
+
+  void SetUp() override
+  {
+    Error error;
+    grids = CreateGridMap(&error);
+    ASSERT_TRUE(IsSuccess(error));
+    profiles = CreateProfileMap(&error);
+    ASSERT_TRUE(IsSuccess(error));
+    radiators = CreateRadiatorMap(&error);
+    ASSERT_TRUE(IsSuccess(error));
+    tuvx = CreateTuvx("configs/tuvx/fixed/config.json", grids, profiles, radiators, &error);
+    ASSERT_TRUE(IsSuccess(error));
+    DeleteError(&error);
+  }
+
+  void TearDown() override
+  {
+    Error error;
+    DeleteTuvx(tuvx, &error);
+    DeleteGridMap(grids, &error);
+    DeleteProfileMap(profiles, &error);
+    DeleteRadiatorMap(radiators, &error);
+    DeleteError(&error);
+  }
+};
+
+TEST_F(PhotolysisCouplerTest, ScattersLayerAveragesIntoState)
+{
+  for (const MICMSolver solver_type : solver_types)
+  {
+    MICM micm("configs/v0/chapman", solver_type);
+    State state(micm, 5);
+    PhotolysisCoupler coupler(
+        *tuvx,
+        state,
+        { { "jfoo", "PHOTO.jO2" }, { "jbar", "PHOTO.jO3->O", 2.0 }, { "jbaz", "PHOTO.jO3->O1D" } });
+    const std::map<std::string, int> tuvx_index = { { "PHOTO.jO2", 0 }, { "PHOTO.jO3->O", 1 }, { "PHOTO.jO3->O1D", 2 } };
+    const std::map<std::string, double> scale = { { "PHOTO.jO2", 1.0 },
+                                                  { "PHOTO.jO3->O", 2.0 },
+                                                  { "PHOTO.jO3->O1D", 1.0 } };
+
+    // the column's three layers occupy grid cells 1-3; cells 0 and 4 are left unchanged
+    std::map<std::string, std::vector<double>> initial;
+    for (const auto& [label, index] : tuvx_index)
+      initial[label] = std::vector<double>(5, -1.0);
+    state.SetRateConstants(initial, solver_type);
+
+    Error error;
+    coupler.Run(0.1, 1.1, state, 1, &error);
+    ASSERT_TRUE(IsSuccess(error));
+    auto rate_constants = state.GetRateConstants(solver_type);
+    for (const auto& [label, index] : tuvx_index)
+    {
+      const auto& values = rate_constants[label];
+      EXPECT_EQ(values[0], -1.0);
+      EXPECT_EQ(values[4], -1.0);
+      for (int i_layer = 0; i_layer < 3; ++i_layer)
+      {
+        const double expected = scale.at(label) * 0.5 *
+                                (expected_photolysis_rate_constants[index][i_layer] +
+                                 expected_photolysis_rate_constants[index][i_layer + 1]);
+        EXPECT_NEAR(values[i_layer + 1], expected, expected * 1.0e-5);
+      }
+    }
+
+    // a column that does not fit in the state is rejected
+    coupler.Run(0.1, 1.1, state, 3, &error);
+    EXPECT_FALSE(IsSuccess(error));
+    DeleteError(&error);
+  }
+}
+
+TEST_F(PhotolysisCouplerTest, UsesEdgeToMidpointRule)
+{
+  for (const MICMSolver solver_type : solver_types)
+  {
+    MICM micm("configs/v0/chapman", solver_type);
+    State state(micm, 3);
+    PhotolysisCoupler coupler(*tuvx, state, { { "jfoo", "PHOTO.jO2" } }, EdgeToMidpointRule::UpperEdge);
+    std::vector<double> photolysis_rate_constants(3 * 4, 0.0);
+    for (int i_edge = 0; i_edge < 4; ++i_edge)
+      photolysis_rate_constants[i_edge] = 1.0 + i_edge;
+
+    Error error;
+    coupler.Scatter(photolysis_rate_constants.data(), state, 0, &error);
+    ASSERT_TRUE(IsSuccess(error));
+    const auto values = state.GetRateConstants(solver_type)["PHOTO.jO2"];
+    EXPECT_EQ(values[0], 2.0);
+    EXPECT_EQ(values[1], 3.0);
+    EXPECT_EQ(values[2], 4.0);
+    DeleteError(&error);
+  }
+}
+
+TEST_F(PhotolysisCouplerTest, UnknownLabelsThrow)
+{
+  for (const MICMSolver solver_type : solver_types)
+  {
+    MICM micm("configs/v0/chapman", solver_type);
+    State state(micm, 3);
+    const std::vector<PhotolysisReactionMapping> unknown_tuvx_label = { { "jqux", "PHOTO.jO2" } };
+    const std::vector<PhotolysisReactionMapping> unknown_micm_label = { { "jfoo", "PHOTO.jqux" } };
+    EXPECT_THROW(PhotolysisCoupler coupler(*tuvx, state, unknown_tuvx_label), std::runtime_error);
+    EXPECT_THROW(PhotolysisCoupler coupler(*tuvx, state, unknown_micm_label), std::runtime_error);
+  }
+}
+
@@ -0,0 +1,160 @@
+#include <musica/tuvx/photolysis_interpolator.hpp>
+#include <musica/tuvx/tuvx.hpp>
+#include <musica/tuvx/tuvx_c_interface.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+using namespace musica;
+
+class PhotolysisInterpolatorTest : public ::testing::Test
+{
+ protected:
+  GridMap* grids;
+  ProfileMap* profiles;
+  RadiatorMap* radiators;
+  TUVX* tuvx;
+  std::size_t photolysis_size;
+
+  void SetUp() override
+  {
+    Error error;
+    grids = CreateGridMap(&error);
+    ASSERT_TRUE(IsSuccess(error));
+    profiles = CreateProfileMap(&error);
+    ASSERT_TRUE(IsSuccess(error));
+    radiators = CreateRadiatorMap(&error);
+    ASSERT_TRUE(IsSuccess(error));
+    tuvx = CreateTuvx("configs/tuvx/fixed/config.json", grids, profiles, radiators, &error);
+    ASSERT_TRUE(IsSuccess(error));
+    photolysis_size = 3 * (3 + 1);
+    DeleteError(&error);
+  }
+
+  void TearDown() override
+  {
+    Error error;
+    DeleteTuvx(tuvx, &error);
+    DeleteGridMap(grids, &error);
+    DeleteProfileMap(profiles, &error);
+    DeleteRadiatorMap(radiators, &error);
+    DeleteError(&error);
+  }
+};
+
+TEST_F(PhotolysisInterpolatorTest, ReproducesSnapshots)
+{
+  PhotolysisInterpolator interpolator(*tuvx);
+  Error error;
+  interpolator.Interpolate(0.0, 0.1, nullptr, &error);
+  EXPECT_FALSE(IsSuccess(error));
+  interpolator.Update(0.0, 0.1, 1.1, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  interpolator.Update(900.0, 0.2, 1.1, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  EXPECT_EQ(interpolator.NumberOfSnapshots(), 2);
+  interpolator.Update(900.0, 0.3, 1.1, &error);
+  EXPECT_FALSE(IsSuccess(error));
+
+  std::vector<double> expected(photolysis_size);
+  std::vector<double> interpolated(photolysis_size);
+  RunTuvx(tuvx, 0.2, 1.1, expected.data(), nullptr, nullptr, nullptr, nullptr, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  interpolator.Interpolate(900.0, 0.2, interpolated.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (std::size_t i = 0; i < photolysis_size; ++i)
+    EXPECT_NEAR(interpolated[i], expected[i], std::abs(expected[i]) * 1.0e-12);
+
+  // beyond the night threshold (about 91.8 degrees for the 3 km height grid) the rates are zero
+  interpolator.Interpolate(450.0, 0.51 * std::numbers::pi, interpolated.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (std::size_t i = 0; i < photolysis_size; ++i)
+    EXPECT_EQ(interpolated[i], 0.0);
+  DeleteError(&error);
+}
+
+TEST_F(PhotolysisInterpolatorTest, WeightsByCosineOfSolarZenithAngle)
+{
+  PhotolysisInterpolator interpolator(*tuvx, 3);
+  std::vector<double> rates_a(photolysis_size, 2.0);
+  std::vector<double> rates_b(photolysis_size, 1.0);
+  std::vector<double> rates_c(photolysis_size, 4.0);
+  const double sza_a = std::acos(0.8);
+  const double sza_b = std::acos(0.4);
+  Error error;
+  interpolator.AddSnapshot(0.0, sza_a, rates_a.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+  interpolator.AddSnapshot(100.0, sza_b, rates_b.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+
+  // normalized rates are 2.5 and 2.5, so the result follows the cosine at the requested time
+  std::vector<double> interpolated(photolysis_size);
+  interpolator.Interpolate(50.0, std::acos(0.6), interpolated.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (std::size_t i = 0; i < photolysis_size; ++i)
+    EXPECT_NEAR(interpolated[i], 1.5, 1.0e-12);
+
+  // times beyond the last snapshot use its normalized rates
+  interpolator.Interpolate(150.0, std::acos(0.2), interpolated.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (std::size_t i = 0; i < photolysis_size; ++i)
+    EXPECT_NEAR(interpolated[i], 0.5, 1.0e-12);
+
+  // the oldest snapshot is dropped once the maximum is reached
+  interpolator.AddSnapshot(200.0, sza_a, rates_c.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+  interpolator.AddSnapshot(300.0, sza_a, rates_c.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+  EXPECT_EQ(interpolator.NumberOfSnapshots(), 3);
+  interpolator.Interpolate(0.0, sza_a, interpolated.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (std::size_t i = 0; i < photolysis_size; ++i)
+    EXPECT_NEAR(interpolated[i], 0.8 * 2.5, 1.0e-12);
+  DeleteError(&error);
+}
+
+TEST_F(PhotolysisInterpolatorTest, BlendsNearHorizonSnapshots)
+{
+  constexpr double degrees = std::numbers::pi / 180.0;
+  PhotolysisInterpolator interpolator(*tuvx);
+  std::vector<double> rates_lit(photolysis_size, 2.0);
+  std::vector<double> rates_twilight(photolysis_size, 1.0);
+  std::vector<double> interpolated(photolysis_size);
+  Error error;
+
+  // a taller atmosphere stays lit with the sun a few degrees below the horizon
+  tuvx->SetNightThreshold(95.0 * degrees);
+  interpolator.AddSnapshot(0.0, 88.0 * degrees, rates_lit.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+  interpolator.AddSnapshot(100.0, 94.0 * degrees, rates_twilight.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+
+  // below the horizon but before the night threshold the snapshots are blended linearly in time
+  interpolator.Interpolate(50.0, 92.0 * degrees, interpolated.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (std::size_t i = 0; i < photolysis_size; ++i)
+    EXPECT_NEAR(interpolated[i], 1.5, 1.0e-12);
+
+  // and held beyond the last snapshot
+  interpolator.Interpolate(150.0, 92.0 * degrees, interpolated.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (std::size_t i = 0; i < photolysis_size; ++i)
+    EXPECT_NEAR(interpolated[i], 1.0, 1.0e-12);
+
+  // rates are zero beyond the night threshold
+  interpolator.Interpolate(50.0, 96.0 * degrees, interpolated.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (std::size_t i = 0; i < photolysis_size; ++i)
+    EXPECT_EQ(interpolated[i], 0.0);
+
+  // the default threshold for the 3 km height grid is below 92 degrees
+  tuvx->SetNightThreshold(-1.0);
+  interpolator.Interpolate(50.0, 92.0 * degrees, interpolated.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (std::size_t i = 0; i < photolysis_size; ++i)
+    EXPECT_EQ(interpolated[i], 0.0);
+  DeleteError(&error);
+}
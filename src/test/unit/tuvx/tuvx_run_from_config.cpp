@@ -3,6 +3,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numbers>
+#include <vector>
+
 using namespace musica;
 
 // Expected values for photolysis rate constants and heating rates
@@ -189,6 +195,169 @@ TEST_F(TuvxRunTest, CreateTuvxInstanceWithJsonConfig)
   DeleteError(&error);
 }
 
+TEST_F(TuvxRunTest, RunPhotolysisRateConstantsOnly)
+{
+  const char* json_config_path = "configs/tuvx/fixed/config.json";
+  SetUp(json_config_path);
+  ASSERT_NE(tuvx, nullptr);
+  Error error;
+  RunTuvx(tuvx, 0.1, 1.1, photolysis_rate_constants, nullptr, nullptr, nullptr, nullptr, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (int i = 0; i < number_of_reactions; i++)
+  {
+    for (int j = 0; j < number_of_layers + 1; j++)
+    {
+      EXPECT_NEAR(
+          photolysis_rate_constants[i * (number_of_layers + 1) + j],
+          expected_photolysis_rate_constants[i][j],
+          expected_photolysis_rate_constants[i][j] * 1.0e-5);
+    }
+  }
+  DeleteError(&error);
+}
+
+TEST_F(TuvxRunTest, DarkColumnsAreZeroFilled)
+{
+  const char* json_config_path = "configs/tuvx/fixed/config.json";
+  SetUp(json_config_path);
+  ASSERT_NE(tuvx, nullptr);
+  Error error;
+  const double night_threshold = tuvx->GetNightThreshold(&error);
+  ASSERT_TRUE(IsSuccess(error));
+  EXPECT_GT(night_threshold, std::numbers::pi / 2.0);
+  EXPECT_LT(night_threshold, std::numbers::pi);
+
+  const std::size_t photolysis_size = number_of_reactions * (number_of_layers + 1);
+  const std::size_t heating_size = number_of_heating_rates * (number_of_layers + 1);
+  std::fill_n(photolysis_rate_constants, photolysis_size, -1.0);
+  std::fill_n(heating_rates, heating_size, -1.0);
+  RunTuvx(tuvx, 3.0, 1.1, photolysis_rate_constants, heating_rates, nullptr, nullptr, nullptr, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (std::size_t i = 0; i < photolysis_size; ++i)
+    EXPECT_EQ(photolysis_rate_constants[i], 0.0);
+  for (std::size_t i = 0; i < heating_size; ++i)
+    EXPECT_EQ(heating_rates[i], 0.0);
+
+  // a configured threshold applies even with the sun above the horizon
+  SetTuvxNightThreshold(tuvx, 0.05, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  EXPECT_EQ(tuvx->GetNightThreshold(&error), 0.05);
+  double solar_zenith_angles[2] = { 0.0, 0.1 };
+  double earth_sun_distances[2] = { 1.1, 1.1 };
+  std::vector<double> column_photolysis_rate_constants(2 * photolysis_size, -1.0);
+  RunTuvxColumns(
+      tuvx,
+      2,
+      solar_zenith_angles,
+      earth_sun_distances,
+      nullptr,
+      0,
+      nullptr,
+      0,
+      column_photolysis_rate_constants.data(),
+      nullptr,
+      nullptr,
+      nullptr,
+      nullptr,
+      &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (std::size_t i = 0; i < photolysis_size; ++i)
+  {
+    EXPECT_GT(column_photolysis_rate_constants[i], 0.0);
+    EXPECT_EQ(column_photolysis_rate_constants[photolysis_size + i], 0.0);
+  }
+
+  // restoring the default threshold restores the full calculation
+  SetTuvxNightThreshold(tuvx, -1.0, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  RunTuvx(tuvx, 0.1, 1.1, photolysis_rate_constants, heating_rates, nullptr, nullptr, nullptr, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (int i = 0; i < number_of_reactions; i++)
+  {
+    for (int j = 0; j < number_of_layers + 1; j++)
+    {
+      EXPECT_NEAR(
+          photolysis_rate_constants[i * (number_of_layers + 1) + j],
+          expected_photolysis_rate_constants[i][j],
+          expected_photolysis_rate_constants[i][j] * 1.0e-5);
+    }
+  }
+
+  // an error left over from an earlier call does not stop the next run
+  ToError(MUSICA_ERROR_CATEGORY, 1, "previous failure", MUSICA_SEVERITY_ERROR, &error);
+  std::fill_n(photolysis_rate_constants, photolysis_size, -1.0);
+  tuvx->Run(0.1, 1.1, photolysis_rate_constants, nullptr, nullptr, nullptr, nullptr, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (int i = 0; i < number_of_reactions; i++)
+  {
+    for (int j = 0; j < number_of_layers + 1; j++)
+    {
+      EXPECT_NEAR(
+          photolysis_rate_constants[i * (number_of_layers + 1) + j],
+          expected_photolysis_rate_constants[i][j],
+          expected_photolysis_rate_constants[i][j] * 1.0e-5);
+    }
+  }
+  ToError(MUSICA_ERROR_CATEGORY, 1, "previous failure", MUSICA_SEVERITY_ERROR, &error);
+  tuvx->Run(3.0, 1.1, photolysis_rate_constants, nullptr, nullptr, nullptr, nullptr, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (std::size_t i = 0; i < photolysis_size; ++i)
+    EXPECT_EQ(photolysis_rate_constants[i], 0.0);
+  DeleteError(&error);
+}
+
+TEST_F(TuvxRunTest, RunFromPhotolysisLookupTable)
+{
+  const char* json_config_path = "configs/tuvx/fixed/config.json";
+  SetUp(json_config_path);
+  ASSERT_NE(tuvx, nullptr);
+  Error error;
+  EXPECT_FALSE(tuvx->HasPhotolysisLookupTable());
+  tuvx->RunFromLookupTable(0.1, 1.1, photolysis_rate_constants, &error);
+  EXPECT_FALSE(IsSuccess(error));
+  tuvx->CreatePhotolysisLookupTable({ 0.2, 0.1 }, &error);
+  EXPECT_FALSE(IsSuccess(error));
+  tuvx->CreatePhotolysisLookupTable({ 0.0, 0.1, 0.2 }, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  ASSERT_TRUE(tuvx->HasPhotolysisLookupTable());
+
+  // tabulated angles reproduce the full calculation, including the Earth-Sun distance scaling
+  tuvx->RunFromLookupTable(0.1, 1.1, photolysis_rate_constants, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (int i = 0; i < number_of_reactions; i++)
+  {
+    for (int j = 0; j < number_of_layers + 1; j++)
+    {
+      EXPECT_NEAR(
+          photolysis_rate_constants[i * (number_of_layers + 1) + j],
+          expected_photolysis_rate_constants[i][j],
+          expected_photolysis_rate_constants[i][j] * 1.0e-5);
+    }
+  }
+
+  // angles between tabulated values are linearly interpolated
+  const std::size_t photolysis_size = number_of_reactions * (number_of_layers + 1);
+  std::vector<double> low(photolysis_size), high(photolysis_size), interpolated(photolysis_size);
+  tuvx->Run(0.1, 1.0, low.data(), nullptr, nullptr, nullptr, nullptr, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  tuvx->Run(0.2, 1.0, high.data(), nullptr, nullptr, nullptr, nullptr, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  tuvx->RunFromLookupTable(0.125, 1.0, interpolated.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (std::size_t i = 0; i < photolysis_size; ++i)
+  {
+    const double expected = 0.75 * low[i] + 0.25 * high[i];
+    EXPECT_NEAR(interpolated[i], expected, std::abs(expected) * 1.0e-10);
+  }
+
+  // angles outside the table are clamped
+  tuvx->RunFromLookupTable(0.5, 1.0, interpolated.data(), &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (std::size_t i = 0; i < photolysis_size; ++i)
+    EXPECT_DOUBLE_EQ(interpolated[i], high[i]);
+  DeleteError(&error);
+}
+
 TEST_F(TuvxRunTest, CreateTuvxInstanceWithJsonConfigAndHostData)
 {
   const char* json_config_path = "configs/tuvx/from_host/config.json";
@@ -326,6 +495,7 @@ TEST_F(TuvxRunTest, CreateTuvxInstanceWithJsonConfigAndHostData)
   ASSERT_EQ(temperature_midpoint_values[0], 287.5);
   ASSERT_EQ(temperature_midpoint_values[1], 267.5);
   ASSERT_EQ(temperature_midpoint_values[2], 257.5);
+
   DeleteGrid(heights, &error);
   ASSERT_TRUE(IsSuccess(error));
   DeleteGrid(wavelengths, &error);
@@ -333,4 +503,328 @@ TEST_F(TuvxRunTest, CreateTuvxInstanceWithJsonConfigAndHostData)
   DeleteProfile(temperature, &error);
   ASSERT_TRUE(IsSuccess(error));
   DeleteError(&error);
-}
\ No newline at end of file
+}
+
+TEST_F(TuvxRunTest, RunColumnsWithHostProfiles)
+{
+  const char* json_config_path = "configs/tuvx/from_host/config.json";
+  Error error;
+  GridMap* grids = CreateGridMap(&error);
+  ASSERT_TRUE(IsSuccess(error));
+  ProfileMap* profiles = CreateProfileMap(&error);
+  ASSERT_TRUE(IsSuccess(error));
+  RadiatorMap* radiators = CreateRadiatorMap(&error);
+  ASSERT_TRUE(IsSuccess(error));
+  Grid* heights = CreateGrid("height", "km", 3, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  double height_edges[4] = { 0.0, 1.0, 2.0, 3.0 };
+  SetGridEdges(heights, height_edges, 4, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  double height_midpoints[3] = { 0.5, 1.5, 2.5 };
+  SetGridMidpoints(heights, height_midpoints, 3, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  AddGrid(grids, heights, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  Grid* wavelengths = CreateGrid("wavelength", "nm", 5, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  double wavelength_edges[6] = { 300.0, 400.0, 500.0, 600.0, 700.0, 800.0 };
+  double wavelength_midpoints[5] = { 350.0, 450.0, 550.0, 650.0, 750.0 };
+  SetGridEdges(wavelengths, wavelength_edges, 6, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  SetGridMidpoints(wavelengths, wavelength_midpoints, 5, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  AddGrid(grids, wavelengths, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  Profile* temperature = CreateProfile("temperature", "K", heights, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  AddProfile(profiles, temperature, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  DeleteProfile(temperature, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  DeleteGrid(heights, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  DeleteGrid(wavelengths, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  SetUp(json_config_path, grids, profiles, radiators);
+  ASSERT_NE(tuvx, nullptr);
+  temperature = GetProfile(profiles_in_tuvx, "temperature", "K", &error);
+  ASSERT_TRUE(IsSuccess(error));
+  ASSERT_NE(temperature, nullptr);
+
+  // both columns use the conditions of the single-column test, so both must reproduce its results
+  const std::size_t number_of_columns = 2;
+  double solar_zenith_angles[2] = { 0.1, 0.1 };
+  double earth_sun_distances[2] = { 1.1, 1.1 };
+  double temperature_edge_values[8] = { 300.0, 275.0, 260.0, 255.0, 300.0, 275.0, 260.0, 255.0 };
+  double temperature_midpoint_values[6] = { 287.5, 267.5, 257.5, 287.5, 267.5, 257.5 };
+  ColumnProfile column_profiles[1] = { { temperature, temperature_edge_values, temperature_midpoint_values, nullptr } };
+  const std::size_t photolysis_size = number_of_reactions * (number_of_layers + 1);
+  const std::size_t heating_size = number_of_heating_rates * (number_of_layers + 1);
+  std::vector<double> column_photolysis_rate_constants(number_of_columns * photolysis_size, -1.0);
+  std::vector<double> column_heating_rates(number_of_columns * heating_size, -1.0);
+  RunTuvxColumns(
+      tuvx,
+      number_of_columns,
+      solar_zenith_angles,
+      earth_sun_distances,
+      column_profiles,
+      1,
+      nullptr,
+      0,
+      column_photolysis_rate_constants.data(),
+      column_heating_rates.data(),
+      nullptr,
+      nullptr,
+      nullptr,
+      &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (std::size_t i_column = 0; i_column < number_of_columns; ++i_column)
+  {
+    for (int i = 0; i < number_of_reactions; i++)
+    {
+      for (int j = 0; j < number_of_layers + 1; j++)
+      {
+        EXPECT_NEAR(
+            column_photolysis_rate_constants[i_column * photolysis_size + i * (number_of_layers + 1) + j],
+            expected_photolysis_rate_constants[i][j],
+            expected_photolysis_rate_constants[i][j] * 1.0e-5);
+      }
+    }
+    for (int i = 0; i < number_of_heating_rates; i++)
+    {
+      for (int j = 0; j < number_of_layers + 1; j++)
+      {
+        EXPECT_NEAR(
+            column_heating_rates[i_column * heating_size + i * (number_of_layers + 1) + j],
+            expected_heating_rates[i][j],
+            expected_heating_rates[i][j] * 1.0e-5);
+      }
+    }
+  }
+
+  // a single column of packed host data can be applied without running the solver
+  double updated_edge_values[8] = { 300.0, 275.0, 260.0, 255.0, 290.0, 270.0, 250.0, 240.0 };
+  double updated_midpoint_values[6] = { 287.5, 267.5, 257.5, 280.0, 260.0, 245.0 };
+  column_profiles[0] = { temperature, updated_edge_values, updated_midpoint_values, nullptr };
+  UpdateTuvxColumn(tuvx, 1, column_profiles, 1, nullptr, 0, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  double edge_values[4];
+  double midpoint_values[3];
+  GetProfileEdgeValues(temperature, edge_values, 4, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  GetProfileMidpointValues(temperature, midpoint_values, 3, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (int i = 0; i < 4; ++i)
+    EXPECT_EQ(edge_values[i], updated_edge_values[4 + i]);
+  for (int i = 0; i < 3; ++i)
+    EXPECT_EQ(midpoint_values[i], updated_midpoint_values[3 + i]);
+  ColumnProfile unset_profile[1] = { { nullptr, updated_edge_values, nullptr, nullptr } };
+  UpdateTuvxColumn(tuvx, 0, unset_profile, 1, nullptr, 0, &error);
+  EXPECT_FALSE(IsSuccess(error));
+  DeleteProfile(temperature, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  DeleteError(&error);
+}
+
+TEST_F(TuvxRunTest, WavelengthBinsMapHostGrid)
+{
+  const char* json_config_path = "configs/tuvx/full_from_host/config.json";
+  Error error;
+  GridMap grids(&error);
+  ASSERT_TRUE(IsSuccess(error));
+  ProfileMap profiles(&error);
+  ASSERT_TRUE(IsSuccess(error));
+  RadiatorMap radiators(&error);
+  ASSERT_TRUE(IsSuccess(error));
+  Grid heights("height", "km", 3, &error);
+  double height_edges[4] = { 0.0, 1.0, 2.0, 3.0 };
+  double height_midpoints[3] = { 0.5, 1.5, 2.5 };
+  heights.SetEdges(height_edges, 4, &error);
+  heights.SetMidpoints(height_midpoints, 3, &error);
+  grids.AddGrid(&heights, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  Grid wavelengths("wavelength", "nm", 5, &error);
+  double wavelength_edges[6] = { 300.0, 400.0, 500.0, 600.0, 700.0, 800.0 };
+  double wavelength_midpoints[5] = { 350.0, 450.0, 550.0, 650.0, 750.0 };
+  wavelengths.SetEdges(wavelength_edges, 6, &error);
+  wavelengths.SetMidpoints(wavelength_midpoints, 5, &error);
+  grids.AddGrid(&wavelengths, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  auto add_profile = [&](const char* name, const char* units, Grid* grid, std::vector<double> edge_values, bool densities)
+  {
+    Profile profile(name, units, grid, &error);
+    std::vector<double> midpoint_values(edge_values.size() - 1);
+    for (std::size_t i = 0; i < midpoint_values.size(); ++i)
+      midpoint_values[i] = 0.5 * (edge_values[i] + edge_values[i + 1]);
+    profile.SetEdgeValues(edge_values.data(), edge_values.size(), &error);
+    profile.SetMidpointValues(midpoint_values.data(), midpoint_values.size(), &error);
+    if (densities)
+    {
+      // 1 km layers
+      for (double& value : midpoint_values)
+        value *= 1.0e5;
+      profile.SetLayerDensities(midpoint_values.data(), midpoint_values.size(), &error);
+      profile.CalculateExoLayerDensity(8.5, &error);
+    }
+    profiles.AddProfile(&profile, &error);
+    ASSERT_TRUE(IsSuccess(error));
+  };
+  add_profile("temperature", "K", &heights, { 300.0, 275.0, 260.0, 255.0 }, false);
+  add_profile("air", "molecule cm-3", &heights, { 2.0e19, 1.8e19, 1.6e19, 1.2e19 }, true);
+  add_profile("O2", "molecule cm-3", &heights, { 5.0e17, 4.5e17, 4.0e17, 2.3e17 }, true);
+  const std::vector<double> albedo_edge_values = { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6 };
+  const std::vector<double> flux_edge_values = { 1.2e14, 1.3e14, 1.1e14, 1.5e14, 1.9e14, 1.7e14 };
+  add_profile("surface albedo", "none", &wavelengths, albedo_edge_values, false);
+  add_profile("extraterrestrial flux", "photon cm-2 s-1", &wavelengths, flux_edge_values, false);
+
+  // cloud optical properties vary with wavelength so that each bin has a distinct flux-weighted mean (wavelength, layer)
+  std::vector<double> optical_depths(15);
+  std::vector<double> single_scattering_albedos(15);
+  std::vector<double> asymmetry_factors(15);
+  for (std::size_t i_wavelength = 0; i_wavelength < 5; ++i_wavelength)
+  {
+    for (std::size_t i_layer = 0; i_layer < 3; ++i_layer)
+    {
+      optical_depths[i_wavelength * 3 + i_layer] = 0.01 * static_cast<double>((i_wavelength + 1) * (3 - i_layer));
+      single_scattering_albedos[i_wavelength * 3 + i_layer] = 0.95 - 0.05 * static_cast<double>(i_wavelength);
+      asymmetry_factors[i_wavelength * 3 + i_layer] = 0.5 + 0.08 * static_cast<double>(i_wavelength + i_layer);
+    }
+  }
+  Radiator clouds("clouds", &heights, &wavelengths, &error);
+  clouds.SetOpticalDepths(optical_depths.data(), 3, 5, &error);
+  clouds.SetSingleScatteringAlbedos(single_scattering_albedos.data(), 3, 5, &error);
+  clouds.SetAsymmetryFactors(asymmetry_factors.data(), 3, 5, 1, &error);
+  radiators.AddRadiator(&clouds, &error);
+  ASSERT_TRUE(IsSuccess(error));
+
+  auto run = [&](const std::vector<double>& bin_edges, std::unique_ptr<TUVX>& instance, std::vector<double>& photolysis)
+  {
+    instance = std::make_unique<TUVX>();
+    instance->SetWavelengthBins(bin_edges);
+    instance->Create(json_config_path, &grids, &profiles, &radiators, &error);
+    ASSERT_TRUE(IsSuccess(error));
+    photolysis.resize(instance->GetPhotolysisRateConstantCount() * (instance->GetNumberOfHeightMidpoints() + 1));
+    NoError(&error);
+    instance->Run(0.1, 1.1, photolysis.data(), nullptr, nullptr, nullptr, nullptr, &error);
+    ASSERT_TRUE(IsSuccess(error));
+  };
+
+  // bins that match the host grid reproduce the full calculation
+  std::unique_ptr<TUVX> full;
+  std::unique_ptr<TUVX> matched;
+  std::unique_ptr<TUVX> coarse;
+  std::vector<double> full_rates;
+  std::vector<double> matched_rates;
+  std::vector<double> coarse_rates;
+  run({}, full, full_rates);
+  run({ 300.0, 400.0, 500.0, 600.0, 700.0, 800.0 }, matched, matched_rates);
+  ASSERT_NE(matched, nullptr);
+  EXPECT_EQ(matched->GetNumberOfWavelengthMidpoints(), 5);
+  ASSERT_EQ(matched_rates.size(), full_rates.size());
+  for (std::size_t i = 0; i < full_rates.size(); ++i)
+    EXPECT_NEAR(matched_rates[i], full_rates[i], std::abs(full_rates[i]) * 1.0e-10);
+
+  // bin edges are moved to the nearest host grid edges
+  run({ 310.0, 480.0, 790.0 }, coarse, coarse_rates);
+  ASSERT_NE(coarse, nullptr);
+  EXPECT_EQ(coarse->GetNumberOfWavelengthMidpoints(), 2);
+  std::unique_ptr<GridMap> coarse_grids(coarse->GetGridMap(&error));
+  ASSERT_TRUE(IsSuccess(error));
+  std::unique_ptr<Grid> bins(coarse_grids->GetGrid("wavelength", "nm", &error));
+  ASSERT_TRUE(IsSuccess(error));
+  double bin_edges[3];
+  bins->GetEdges(bin_edges, 3, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  EXPECT_EQ(bin_edges[0], 300.0);
+  EXPECT_EQ(bin_edges[1], 500.0);
+  EXPECT_EQ(bin_edges[2], 800.0);
+  double bin_midpoints[2];
+  bins->GetMidpoints(bin_midpoints, 2, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  EXPECT_EQ(bin_midpoints[0], 400.0);
+  EXPECT_EQ(bin_midpoints[1], 650.0);
+  for (const double rate : coarse_rates)
+  {
+    EXPECT_TRUE(std::isfinite(rate));
+    EXPECT_GE(rate, 0.0);
+  }
+
+  // binned values are the flux-weighted means of the host values in each bin (the flux itself is summed)
+  const std::size_t first[2] = { 0, 2 };
+  const std::size_t last[2] = { 2, 5 };
+  std::vector<double> flux(5);
+  std::vector<double> albedo(5);
+  for (std::size_t i = 0; i < 5; ++i)
+  {
+    flux[i] = 0.5 * (flux_edge_values[i] + flux_edge_values[i + 1]);
+    albedo[i] = 0.5 * (albedo_edge_values[i] + albedo_edge_values[i + 1]);
+  }
+  std::unique_ptr<ProfileMap> coarse_profiles(coarse->GetProfileMap(&error));
+  ASSERT_TRUE(IsSuccess(error));
+  std::unique_ptr<Profile> binned_flux(coarse_profiles->GetProfile("extraterrestrial flux", "photon cm-2 s-1", &error));
+  ASSERT_TRUE(IsSuccess(error));
+  std::unique_ptr<Profile> binned_albedo(coarse_profiles->GetProfile("surface albedo", "none", &error));
+  ASSERT_TRUE(IsSuccess(error));
+  double binned_flux_values[2];
+  double binned_albedo_values[2];
+  binned_flux->GetMidpointValues(binned_flux_values, 2, &error);
+  binned_albedo->GetMidpointValues(binned_albedo_values, 2, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  std::unique_ptr<RadiatorMap> coarse_radiators(coarse->GetRadiatorMap(&error));
+  ASSERT_TRUE(IsSuccess(error));
+  std::unique_ptr<Radiator> binned_clouds(coarse_radiators->GetRadiator("clouds", &error));
+  ASSERT_TRUE(IsSuccess(error));
+  double binned_optical_depths[6];
+  double binned_single_scattering_albedos[6];
+  double binned_asymmetry_factors[6];
+  binned_clouds->GetOpticalDepths(binned_optical_depths, 3, 2, &error);
+  binned_clouds->GetSingleScatteringAlbedos(binned_single_scattering_albedos, 3, 2, &error);
+  binned_clouds->GetAsymmetryFactors(binned_asymmetry_factors, 3, 2, 1, &error);
+  ASSERT_TRUE(IsSuccess(error));
+  for (std::size_t i_bin = 0; i_bin < 2; ++i_bin)
+  {
+    double total_flux = 0.0;
+    double flux_albedo = 0.0;
+    for (std::size_t i = first[i_bin]; i < last[i_bin]; ++i)
+    {
+      total_flux += flux[i];
+      flux_albedo += flux[i] * albedo[i];
+    }
+    EXPECT_NEAR(binned_flux_values[i_bin], total_flux, total_flux * 1.0e-12);
+    EXPECT_NEAR(binned_albedo_values[i_bin], flux_albedo / total_flux, 1.0e-12);
+    for (std::size_t i_layer = 0; i_layer < 3; ++i_layer)
+    {
+      double extinction = 0.0;
+      double scattering = 0.0;
+      double asymmetry = 0.0;
+      for (std::size_t i = first[i_bin]; i < last[i_bin]; ++i)
+      {
+        const double tau = optical_depths[i * 3 + i_layer];
+        const double omega = single_scattering_albedos[i * 3 + i_layer];
+        extinction += flux[i] * tau;
+        scattering += flux[i] * tau * omega;
+        asymmetry += flux[i] * tau * omega * asymmetry_factors[i * 3 + i_layer];
+      }
+      EXPECT_NEAR(binned_optical_depths[i_bin * 3 + i_layer], extinction / total_flux, 1.0e-12);
+      EXPECT_NEAR(binned_single_scattering_albedos[i_bin * 3 + i_layer], scattering / extinction, 1.0e-12);
+      EXPECT_NEAR(binned_asymmetry_factors[i_bin * 3 + i_layer], asymmetry / scattering, 1.0e-12);
+    }
+  }
+
+  // other host profiles on the wavelength grid cannot be binned
+  add_profile("spectral weight", "none", &wavelengths, { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 }, false);
+  TUVX unknown_profile;
+  unknown_profile.SetWavelengthBins({ 300.0, 500.0, 800.0 });
+  unknown_profile.Create(json_config_path, &grids, &profiles, &radiators, &error);
+  EXPECT_FALSE(IsSuccess(error));
+
+  // bins require the host to supply the wavelength grid
+  TUVX fixed;
+  fixed.SetWavelengthBins({ 300.0, 500.0, 800.0 });
+  GridMap no_grids(&error);
+  ProfileMap no_profiles(&error);
+  RadiatorMap no_radiators(&error);
+  fixed.Create("configs/tuvx/fixed/config.json", &no_grids, &no_profiles, &no_radiators, &error);
+  EXPECT_FALSE(IsSuccess(error));
+  DeleteError(&error);
+}
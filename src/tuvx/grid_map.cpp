@@ -5,6 +5,7 @@
 #include <cstring>
 #include <filesystem>
 #include <iostream>
+#include <utility>
 
 namespace
 {
@@ -72,6 +73,12 @@ namespace musica
     return grid_map->GetGrid(grid_name, grid_units, error);
   }
 
+  Grid *ResolveGrid(GridMap *grid_map, const char *grid_name, const char *grid_units, Error *error)
+  {
+    DeleteError(error);
+    return grid_map->ResolveGrid(grid_name, grid_units, error);
+  }
+
   Grid *GetGridByIndex(GridMap *grid_map, std::size_t index, Error *error)
   {
     DeleteError(error);
@@ -113,6 +120,7 @@ namespace musica
 
   GridMap::~GridMap()
   {
+    resolved_grids_.clear();
     int error_code = 0;
     if (grid_map_ != nullptr && owns_grid_map_)
     {
@@ -264,6 +272,23 @@ namespace musica
     return grid;
   }
 
+  Grid *GridMap::ResolveGrid(const char *grid_name, const char *grid_units, Error *error)
+  {
+    DeleteError(error);
+    auto key = std::make_pair(std::string(grid_name), std::string(grid_units));
+    auto resolved = resolved_grids_.find(key);
+    if (resolved != resolved_grids_.end())
+    {
+      NoError(error);
+      return resolved->second.get();
+    }
+    Grid *grid = GetGrid(grid_name, grid_units, error);
+    if (grid == nullptr)
+      return nullptr;
+    resolved_grids_.emplace(std::move(key), std::unique_ptr<Grid>(grid));
+    return grid;
+  }
+
   Grid *GridMap::GetGridByIndex(std::size_t index, Error *error)
   {
     if (grid_map_ == nullptr)
@@ -369,6 +394,7 @@ namespace musica
 
   void GridMap::RemoveGrid(const char *grid_name, const char *grid_units, Error *error)
   {
+    resolved_grids_.clear();
     if (grid_map_ == nullptr)
     {
       ToError(
@@ -410,6 +436,7 @@ namespace musica
 
   void GridMap::RemoveGridByIndex(std::size_t index, Error *error)
   {
+    resolved_grids_.clear();
     if (grid_map_ == nullptr)
     {
       ToError(
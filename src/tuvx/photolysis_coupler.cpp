@@ -0,0 +1,122 @@
+// Copyright (C) 2023-2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// This file contains the implementation of the PhotolysisCoupler class.
+#include <musica/tuvx/photolysis_coupler.hpp>
+
+#include <stdexcept>
+
+namespace musica
+{
+  PhotolysisCoupler::PhotolysisCoupler(
+      TUVX &tuvx,
+      State &state,
+      const std::vector<PhotolysisReactionMapping> &reactions,
+      const EdgeToMidpointRule rule)
+      : tuvx_(tuvx),
+        rule_(rule)
+  {
+    number_of_layers_ = static_cast<std::size_t>(tuvx_.GetNumberOfHeightMidpoints());
+    photolysis_rate_constants_.resize(
+        static_cast<std::size_t>(tuvx_.GetPhotolysisRateConstantCount()) * (number_of_layers_ + 1));
+
+    Error error;
+    Mappings tuvx_labels;
+    tuvx_.GetPhotolysisRateConstantsOrdering(&tuvx_labels, &error);
+    if (!IsSuccess(error))
+    {
+      std::string message = error.message_.value_ ? error.message_.value_ : "";
+      DeleteError(&error);
+      throw std::runtime_error("Failed to get TUV-x photolysis rate constant ordering: " + message);
+    }
+    const auto rate_parameter_map = state.GetRateParameterMap();
+    for (const auto &reaction : reactions)
+    {
+      const std::size_t tuvx_index = FindMappingIndex(tuvx_labels, reaction.tuvx_label.c_str(), &error);
+      if (!IsSuccess(error))
+      {
+        DeleteMappings(&tuvx_labels);
+        DeleteError(&error);
+        throw std::runtime_error("TUV-x photolysis rate constant '" + reaction.tuvx_label + "' not found");
+      }
+      const auto micm_index = rate_parameter_map.find(reaction.micm_label);
+      if (micm_index == rate_parameter_map.end())
+      {
+        DeleteMappings(&tuvx_labels);
+        DeleteError(&error);
+        throw std::runtime_error("MICM rate parameter '" + reaction.micm_label + "' not found");
+      }
+      mappings_.push_back({ tuvx_index, micm_index->second, reaction.scale_factor });
+    }
+    DeleteMappings(&tuvx_labels);
+    DeleteError(&error);
+
+    // element (cell, parameter) of a rate parameter matrix with L cells per group is at
+    // ((cell / L) * number_of_parameters + parameter) * L + cell % L, where L is the column stride
+    number_of_rate_parameters_ = rate_parameter_map.size();
+    vector_size_ = state.GetUserDefinedRateParametersStrides().second;
+  }
+
+  void PhotolysisCoupler::Run(
+      const double solar_zenith_angle,
+      const double earth_sun_distance,
+      State &state,
+      const std::size_t first_grid_cell,
+      Error *const error)
+  {
+    DeleteError(error);
+    NoError(error);
+    tuvx_.Run(
+        solar_zenith_angle,
+        earth_sun_distance,
+        photolysis_rate_constants_.data(),
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        error);
+    if (!IsSuccess(*error))
+      return;
+    Scatter(photolysis_rate_constants_.data(), state, first_grid_cell, error);
+  }
+
+  void PhotolysisCoupler::Scatter(
+      const double *const photolysis_rate_constants,
+      State &state,
+      const std::size_t first_grid_cell,
+      Error *const error) const
+  {
+    DeleteError(error);
+    if (first_grid_cell + number_of_layers_ > state.NumberOfGridCells())
+    {
+      ToError(MUSICA_ERROR_CATEGORY, 1, "Column does not fit in the MICM State", MUSICA_SEVERITY_ERROR, error);
+      return;
+    }
+    auto &rate_parameters = state.GetOrderedRateParameters();
+    if (rate_parameters.size() < number_of_rate_parameters_ * state.NumberOfGridCells())
+    {
+      ToError(MUSICA_ERROR_CATEGORY, 1, "MICM State layout does not match the coupler", MUSICA_SEVERITY_ERROR, error);
+      return;
+    }
+    const std::size_t number_of_edges = number_of_layers_ + 1;
+    for (const auto &mapping : mappings_)
+    {
+      const double *const edges = photolysis_rate_constants + mapping.source_ * number_of_edges;
+      for (std::size_t i_layer = 0; i_layer < number_of_layers_; ++i_layer)
+      {
+        double value = 0.0;
+        switch (rule_)
+        {
+          case EdgeToMidpointRule::Average: value = 0.5 * (edges[i_layer] + edges[i_layer + 1]); break;
+          case EdgeToMidpointRule::LowerEdge: value = edges[i_layer]; break;
+          case EdgeToMidpointRule::UpperEdge: value = edges[i_layer + 1]; break;
+        }
+        const std::size_t i_cell = first_grid_cell + i_layer;
+        const std::size_t index = ((i_cell / vector_size_) * number_of_rate_parameters_ + mapping.target_) * vector_size_ +
+                                  i_cell % vector_size_;
+        rate_parameters[index] = mapping.scale_factor_ * value;
+      }
+    }
+    NoError(error);
+  }
+}  // namespace musica
@@ -0,0 +1,150 @@
+// Copyright (C) 2023-2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// This file contains the implementation of the PhotolysisInterpolator class.
+#include <musica/tuvx/photolysis_interpolator.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+  // With the sun this close to or below the horizon, the cosine of the solar zenith angle no longer
+  // describes the rates (which stay positive until the night threshold), so rates are interpolated
+  // without normalization
+  constexpr double MINIMUM_NORMALIZING_COSINE = 1.0e-2;
+}  // namespace
+
+namespace musica
+{
+  PhotolysisInterpolator::PhotolysisInterpolator(TUVX &tuvx, const std::size_t max_snapshots)
+      : tuvx_(tuvx),
+        max_snapshots_(std::max<std::size_t>(max_snapshots, 2))
+  {
+    photolysis_size_ = (static_cast<std::size_t>(tuvx_.GetNumberOfHeightMidpoints()) + 1) *
+                       static_cast<std::size_t>(tuvx_.GetPhotolysisRateConstantCount());
+  }
+
+  void PhotolysisInterpolator::Update(
+      const double time,
+      const double solar_zenith_angle,
+      const double earth_sun_distance,
+      Error *const error)
+  {
+    DeleteError(error);
+    NoError(error);
+    std::vector<double> photolysis_rate_constants(photolysis_size_);
+    tuvx_.Run(
+        solar_zenith_angle,
+        earth_sun_distance,
+        photolysis_rate_constants.data(),
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        error);
+    if (!IsSuccess(*error))
+      return;
+    AddSnapshot(time, solar_zenith_angle, photolysis_rate_constants.data(), error);
+  }
+
+  void PhotolysisInterpolator::AddSnapshot(
+      const double time,
+      const double solar_zenith_angle,
+      const double *const photolysis_rate_constants,
+      Error *const error)
+  {
+    DeleteError(error);
+    if (!snapshots_.empty() && time <= snapshots_.back().time)
+    {
+      ToError(
+          MUSICA_ERROR_CATEGORY,
+          1,
+          "Photolysis snapshots must be added in increasing time order",
+          MUSICA_SEVERITY_ERROR,
+          error);
+      return;
+    }
+    if (snapshots_.size() == max_snapshots_)
+    {
+      // reuse the storage of the oldest snapshot
+      Snapshot oldest = std::move(snapshots_.front());
+      snapshots_.pop_front();
+      snapshots_.push_back(std::move(oldest));
+    }
+    else
+    {
+      snapshots_.emplace_back();
+    }
+    Snapshot &snapshot = snapshots_.back();
+    snapshot.time = time;
+    snapshot.cosine_solar_zenith_angle = std::max(std::cos(solar_zenith_angle), 0.0);
+    snapshot.photolysis_rate_constants.assign(photolysis_rate_constants, photolysis_rate_constants + photolysis_size_);
+    NoError(error);
+  }
+
+  void PhotolysisInterpolator::Interpolate(
+      const double time,
+      const double solar_zenith_angle,
+      double *const photolysis_rate_constants,
+      Error *const error) const
+  {
+    DeleteError(error);
+    if (snapshots_.empty())
+    {
+      ToError(MUSICA_ERROR_CATEGORY, 1, "No photolysis snapshots have been stored", MUSICA_SEVERITY_ERROR, error);
+      return;
+    }
+    // use the same night threshold as TUVX::Run, so the upper layers stay lit just after sunset
+    const double night_threshold = tuvx_.GetNightThreshold(error);
+    if (!IsSuccess(*error))
+      return;
+    if (solar_zenith_angle >= night_threshold)
+    {
+      std::fill_n(photolysis_rate_constants, photolysis_size_, 0.0);
+      NoError(error);
+      return;
+    }
+    const double cosine = std::cos(solar_zenith_angle);
+    const bool normalize = cosine >= MINIMUM_NORMALIZING_COSINE;
+
+    // find the snapshots bracketing the requested time, clamping to the stored range
+    auto upper = std::upper_bound(
+        snapshots_.begin(), snapshots_.end(), time, [](double t, const Snapshot &snapshot) { return t < snapshot.time; });
+    const Snapshot &after = upper == snapshots_.end() ? snapshots_.back() : *upper;
+    const Snapshot &before = upper == snapshots_.begin() ? snapshots_.front() : *(upper - 1);
+    const double weight = &before == &after ? 0.0 : (time - before.time) / (after.time - before.time);
+
+    const bool normalize_before = normalize && before.cosine_solar_zenith_angle >= MINIMUM_NORMALIZING_COSINE;
+    const bool normalize_after = normalize && after.cosine_solar_zenith_angle >= MINIMUM_NORMALIZING_COSINE;
+    const double *const rates_before = before.photolysis_rate_constants.data();
+    const double *const rates_after = after.photolysis_rate_constants.data();
+    if (normalize_before && normalize_after)
+    {
+      const double scale_before = (1.0 - weight) * cosine / before.cosine_solar_zenith_angle;
+      const double scale_after = weight * cosine / after.cosine_solar_zenith_angle;
+      for (std::size_t i = 0; i < photolysis_size_; ++i)
+        photolysis_rate_constants[i] = scale_before * rates_before[i] + scale_after * rates_after[i];
+    }
+    else if (normalize_before || normalize_after)
+    {
+      // near sunrise or sunset only the lit snapshot carries the shape of the diurnal cycle
+      const Snapshot &lit = normalize_before ? before : after;
+      const double scale = cosine / lit.cosine_solar_zenith_angle;
+      for (std::size_t i = 0; i < photolysis_size_; ++i)
+        photolysis_rate_constants[i] = scale * lit.photolysis_rate_constants[i];
+    }
+    else
+    {
+      // near the horizon the snapshots are blended linearly in time (or held beyond the stored range)
+      for (std::size_t i = 0; i < photolysis_size_; ++i)
+        photolysis_rate_constants[i] = (1.0 - weight) * rates_before[i] + weight * rates_after[i];
+    }
+    NoError(error);
+  }
+
+  std::size_t PhotolysisInterpolator::NumberOfSnapshots() const
+  {
+    return snapshots_.size();
+  }
+}  // namespace musica
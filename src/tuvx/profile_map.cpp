@@ -5,6 +5,7 @@
 #include <cstring>
 #include <filesystem>
 #include <iostream>
+#include <utility>
 
 namespace
 {
@@ -72,6 +73,12 @@ namespace musica
     return profile_map->GetProfile(profile_name, profile_units, error);
   }
 
+  Profile *ResolveProfile(ProfileMap *profile_map, const char *profile_name, const char *profile_units, Error *error)
+  {
+    DeleteError(error);
+    return profile_map->ResolveProfile(profile_name, profile_units, error);
+  }
+
   Profile *GetProfileByIndex(ProfileMap *profile_map, std::size_t index, Error *error)
   {
     DeleteError(error);
@@ -114,6 +121,7 @@ namespace musica
 
   ProfileMap::~ProfileMap()
   {
+    resolved_profiles_.clear();
     int error_code = 0;
     if (profile_map_ != nullptr && owns_profile_map_)
     {
@@ -265,6 +273,23 @@ namespace musica
     return profile;
   }
 
+  Profile *ProfileMap::ResolveProfile(const char *profile_name, const char *profile_units, Error *error)
+  {
+    DeleteError(error);
+    auto key = std::make_pair(std::string(profile_name), std::string(profile_units));
+    auto resolved = resolved_profiles_.find(key);
+    if (resolved != resolved_profiles_.end())
+    {
+      NoError(error);
+      return resolved->second.get();
+    }
+    Profile *profile = GetProfile(profile_name, profile_units, error);
+    if (profile == nullptr)
+      return nullptr;
+    resolved_profiles_.emplace(std::move(key), std::unique_ptr<Profile>(profile));
+    return profile;
+  }
+
   Profile *ProfileMap::GetProfileByIndex(std::size_t index, Error *error)
   {
     DeleteError(error);
@@ -328,6 +353,7 @@ namespace musica
   void ProfileMap::RemoveProfile(const char *profile_name, const char *profile_units, Error *error)
   {
     DeleteError(error);
+    resolved_profiles_.clear();
     if (profile_map_ == nullptr)
     {
       ToError(
@@ -372,6 +398,7 @@ namespace musica
   void ProfileMap::RemoveProfileByIndex(std::size_t index, Error *error)
   {
     DeleteError(error);
+    resolved_profiles_.clear();
     if (profile_map_ == nullptr)
     {
       ToError(
@@ -5,6 +5,7 @@
 #include <cstring>
 #include <filesystem>
 #include <iostream>
+#include <utility>
 
 namespace
 {
@@ -71,6 +72,12 @@ namespace musica
     return radiator_map->GetRadiator(radiator_name, error);
   }
 
+  Radiator *ResolveRadiator(RadiatorMap *radiator_map, const char *radiator_name, Error *error)
+  {
+    DeleteError(error);
+    return radiator_map->ResolveRadiator(radiator_name, error);
+  }
+
   Radiator *GetRadiatorByIndex(RadiatorMap *radiator_map, std::size_t index, Error *error)
   {
     DeleteError(error);
@@ -112,6 +119,7 @@ namespace musica
 
   RadiatorMap::~RadiatorMap()
   {
+    resolved_radiators_.clear();
     int error_code = ERROR_NONE;
     if (radiator_map_ != nullptr && owns_radiator_map_)
     {
@@ -261,6 +269,23 @@ namespace musica
     return radiator;
   }
 
+  Radiator *RadiatorMap::ResolveRadiator(const char *radiator_name, Error *error)
+  {
+    DeleteError(error);
+    auto key = std::string(radiator_name);
+    auto resolved = resolved_radiators_.find(key);
+    if (resolved != resolved_radiators_.end())
+    {
+      NoError(error);
+      return resolved->second.get();
+    }
+    Radiator *radiator = GetRadiator(radiator_name, error);
+    if (radiator == nullptr)
+      return nullptr;
+    resolved_radiators_.emplace(std::move(key), std::unique_ptr<Radiator>(radiator));
+    return radiator;
+  }
+
   Radiator *RadiatorMap::GetRadiatorByIndex(std::size_t index, Error *error)
   {
     int error_code = ERROR_NONE;
@@ -324,6 +349,7 @@ namespace musica
   void RadiatorMap::RemoveRadiator(const char *radiator_name, Error *error)
   {
     DeleteError(error);
+    resolved_radiators_.clear();
     int error_code = ERROR_NONE;
     if (radiator_map_ == nullptr)
     {
@@ -365,6 +391,7 @@ namespace musica
 
   void RadiatorMap::RemoveRadiatorByIndex(std::size_t index, Error *error)
   {
+    resolved_radiators_.clear();
     int error_code = ERROR_NONE;
     DeleteError(error);
     if (radiator_map_ == nullptr)
@@ -6,15 +6,190 @@
 #include <musica/tuvx/tuvx.hpp>
 #include <musica/tuvx/tuvx_c_interface.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <filesystem>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <numbers>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace
+{
+  /// @brief Throws (and releases the error) if a MUSICA error is set
+  void ThrowOnError(musica::Error &error)
+  {
+    if (musica::IsSuccess(error))
+      return;
+    const std::string message = error.message_.value_ != nullptr ? error.message_.value_ : "TUV-x error";
+    musica::DeleteError(&error);
+    throw std::runtime_error(message);
+  }
+
+  /// @brief Creates an owned copy of a grid
+  std::unique_ptr<musica::Grid> CopyGrid(musica::Grid &source)
+  {
+    musica::Error error;
+    const std::size_t number_of_sections = source.GetNumberOfSections(&error);
+    ThrowOnError(error);
+    const std::string name = source.GetName(&error);
+    const std::string units = source.GetUnits(&error);
+    ThrowOnError(error);
+    auto grid = std::make_unique<musica::Grid>(name.c_str(), units.c_str(), number_of_sections, &error);
+    ThrowOnError(error);
+    std::vector<double> edges(number_of_sections + 1);
+    std::vector<double> midpoints(number_of_sections);
+    source.GetEdges(edges.data(), edges.size(), &error);
+    ThrowOnError(error);
+    grid->SetEdges(edges.data(), edges.size(), &error);
+    ThrowOnError(error);
+    source.GetMidpoints(midpoints.data(), midpoints.size(), &error);
+    ThrowOnError(error);
+    grid->SetMidpoints(midpoints.data(), midpoints.size(), &error);
+    ThrowOnError(error);
+    musica::DeleteError(&error);
+    return grid;
+  }
+
+  /// @brief Creates an owned copy of a profile
+  std::unique_ptr<musica::Profile> CopyProfile(musica::Profile &source)
+  {
+    musica::Error error;
+    const std::size_t number_of_sections = source.GetNumberOfSections(&error);
+    ThrowOnError(error);
+    const std::string name = source.GetName(&error);
+    const std::string units = source.GetUnits(&error);
+    ThrowOnError(error);
+    // profiles only take their size from the grid they are created on
+    musica::Grid grid(name.c_str(), units.c_str(), number_of_sections, &error);
+    ThrowOnError(error);
+    auto profile = std::make_unique<musica::Profile>(name.c_str(), units.c_str(), &grid, &error);
+    ThrowOnError(error);
+    std::vector<double> edge_values(number_of_sections + 1);
+    std::vector<double> midpoint_values(number_of_sections);
+    std::vector<double> layer_densities(number_of_sections);
+    source.GetEdgeValues(edge_values.data(), edge_values.size(), &error);
+    ThrowOnError(error);
+    profile->SetEdgeValues(edge_values.data(), edge_values.size(), &error);
+    ThrowOnError(error);
+    source.GetMidpointValues(midpoint_values.data(), midpoint_values.size(), &error);
+    ThrowOnError(error);
+    profile->SetMidpointValues(midpoint_values.data(), midpoint_values.size(), &error);
+    ThrowOnError(error);
+    source.GetLayerDensities(layer_densities.data(), layer_densities.size(), &error);
+    ThrowOnError(error);
+    const double exo_layer_density = source.GetExoLayerDensity(&error);
+    ThrowOnError(error);
+    // the exo layer density is folded into the top layer, and is added back when it is set
+    if (!layer_densities.empty())
+      layer_densities.back() -= exo_layer_density;
+    profile->SetLayerDensities(layer_densities.data(), layer_densities.size(), &error);
+    ThrowOnError(error);
+    profile->SetExoLayerDensity(exo_layer_density, &error);
+    ThrowOnError(error);
+    musica::DeleteError(&error);
+    return profile;
+  }
+
+  /// @brief Finds the edges of a wavelength grid nearest to a set of bin edges
+  /// @return Strictly increasing indices of the grid edges that bound each bin
+  /// @throws std::runtime_error if the bin edges are not strictly increasing or collapse to a single edge
+  std::vector<std::size_t> SnapBinEdges(const std::vector<double> &grid_edges, const std::vector<double> &bin_edges)
+  {
+    if (bin_edges.size() < 2 ||
+        std::adjacent_find(bin_edges.begin(), bin_edges.end(), std::greater_equal<double>()) != bin_edges.end())
+      throw std::runtime_error("Wavelength bin edges must be strictly increasing with at least two edges");
+    std::vector<std::size_t> indices;
+    for (const double edge : bin_edges)
+    {
+      const std::size_t upper = std::lower_bound(grid_edges.begin(), grid_edges.end(), edge) - grid_edges.begin();
+      std::size_t index = std::min(upper, grid_edges.size() - 1);
+      if (upper > 0 && (upper == grid_edges.size() || edge - grid_edges[upper - 1] < grid_edges[upper] - edge))
+        index = upper - 1;
+      if (indices.empty() || index > indices.back())
+        indices.push_back(index);
+    }
+    if (indices.size() < 2)
+      throw std::runtime_error("Wavelength bins do not span any of the host wavelength grid");
+    return indices;
+  }
+
+  /// @brief Returns the name of the TUV-x grid that a host profile is defined on
+  ///
+  /// Host profiles do not keep a reference to their grid, so the grid is identified by name: the
+  /// extraterrestrial flux and surface albedo are the host profiles TUV-x reads on the wavelength grid,
+  /// and all other host profiles are taken to be on the height grid (BinHostWavelengths rejects those
+  /// whose size says otherwise).
+  std::string ProfileGridName(const std::string &profile_name)
+  {
+    return profile_name == "extraterrestrial flux" || profile_name == "surface albedo" ? "wavelength" : "height";
+  }
+
+  /// @brief Sums values on a wavelength grid into bins bounded by a subset of its edges
+  std::vector<double> SumBins(const std::vector<double> &values, const std::vector<std::size_t> &edge_indices)
+  {
+    std::vector<double> binned(edge_indices.size() - 1, 0.0);
+    for (std::size_t i_bin = 0; i_bin < binned.size(); ++i_bin)
+      for (std::size_t i = edge_indices[i_bin]; i < edge_indices[i_bin + 1]; ++i)
+        binned[i_bin] += values[i];
+    return binned;
+  }
+
+  /// @brief Averages values on a wavelength grid over bins bounded by a subset of its edges
+  ///
+  /// Each bin takes sum(w_i * x_i) / sum(w_i) over the grid sections i it covers, or the unweighted
+  /// mean where the weights in the bin sum to zero.
+  std::vector<double> WeightedBinMeans(
+      const std::vector<double> &values,
+      const std::vector<double> &weights,
+      const std::vector<std::size_t> &edge_indices)
+  {
+    std::vector<double> binned(edge_indices.size() - 1, 0.0);
+    for (std::size_t i_bin = 0; i_bin < binned.size(); ++i_bin)
+    {
+      double weighted_sum = 0.0;
+      double total_weight = 0.0;
+      double sum = 0.0;
+      for (std::size_t i = edge_indices[i_bin]; i < edge_indices[i_bin + 1]; ++i)
+      {
+        weighted_sum += weights[i] * values[i];
+        total_weight += weights[i];
+        sum += values[i];
+      }
+      binned[i_bin] = total_weight > 0.0 ? weighted_sum / total_weight
+                                         : sum / static_cast<double>(edge_indices[i_bin + 1] - edge_indices[i_bin]);
+    }
+    return binned;
+  }
+
+  /// @brief Bracket a value in a strictly increasing table, clamping to its ends
+  /// @return Index of the lower bracketing entry and the weight of the upper entry
+  std::pair<std::size_t, double> Bracket(const std::vector<double> &table, const double value)
+  {
+    if (table.size() == 1 || value <= table.front())
+      return { 0, 0.0 };
+    if (value >= table.back())
+      return { table.size() - 2, 1.0 };
+    const std::size_t upper = std::upper_bound(table.begin(), table.end(), value) - table.begin();
+    return { upper - 1, (value - table[upper - 1]) / (table[upper] - table[upper - 1]) };
+  }
+
+  bool IsStrictlyIncreasing(const std::vector<double> &values)
+  {
+    return std::adjacent_find(values.begin(), values.end(), std::greater_equal<double>()) == values.end();
+  }
+}  // namespace
 
 namespace musica
 {
   TUVX::TUVX()
-      : tuvx_(nullptr)
+      : tuvx_(nullptr),
+        night_threshold_(-1.0),
+        default_night_threshold_(-1.0)
   {
   }
 
@@ -40,6 +215,17 @@ namespace musica
         return;
       }
 
+      std::unique_ptr<GridMap> binned_grids;
+      std::unique_ptr<ProfileMap> binned_profiles;
+      std::unique_ptr<RadiatorMap> binned_radiators;
+      if (!wavelength_bin_edges_.empty())
+      {
+        BinHostWavelengths(grids, profiles, radiators, binned_grids, binned_profiles, binned_radiators);
+        grids = binned_grids.get();
+        profiles = binned_profiles.get();
+        radiators = binned_radiators.get();
+      }
+
       tuvx_ = InternalCreateTuvx(
           config_path,
           strlen(config_path),
@@ -83,6 +269,17 @@ namespace musica
 
     try
     {
+      std::unique_ptr<GridMap> binned_grids;
+      std::unique_ptr<ProfileMap> binned_profiles;
+      std::unique_ptr<RadiatorMap> binned_radiators;
+      if (!wavelength_bin_edges_.empty())
+      {
+        BinHostWavelengths(grids, profiles, radiators, binned_grids, binned_profiles, binned_radiators);
+        grids = binned_grids.get();
+        profiles = binned_profiles.get();
+        radiators = binned_radiators.get();
+      }
+
       tuvx_ = InternalCreateTuvxFromConfigString(
           config_string,
           strlen(config_string),
@@ -113,6 +310,246 @@ namespace musica
     }
   }
 
+  void TUVX::BinHostWavelengths(
+      GridMap *grids,
+      ProfileMap *profiles,
+      RadiatorMap *radiators,
+      std::unique_ptr<GridMap> &binned_grids,
+      std::unique_ptr<ProfileMap> &binned_profiles,
+      std::unique_ptr<RadiatorMap> &binned_radiators)
+  {
+    Error error;
+    std::unique_ptr<Grid> wavelengths(grids->GetGrid("wavelength", "nm", &error));
+    if (!IsSuccess(error))
+    {
+      DeleteError(&error);
+      throw std::runtime_error("Wavelength bins require the host to supply the wavelength grid (wavelength, nm)");
+    }
+    const std::size_t number_of_wavelengths = wavelengths->GetNumberOfSections(&error);
+    ThrowOnError(error);
+    std::vector<double> edges(number_of_wavelengths + 1);
+    wavelengths->GetEdges(edges.data(), edges.size(), &error);
+    ThrowOnError(error);
+    const std::vector<std::size_t> edge_indices = SnapBinEdges(edges, wavelength_bin_edges_);
+    const std::size_t number_of_bins = edge_indices.size() - 1;
+
+    // the host height grid is optional, and only used to tell height profiles from wavelength profiles
+    std::size_t number_of_heights = 0;
+    std::unique_ptr<Grid> heights(grids->GetGrid("height", "km", &error));
+    if (IsSuccess(error))
+    {
+      number_of_heights = heights->GetNumberOfSections(&error);
+      ThrowOnError(error);
+    }
+    else
+    {
+      heights.reset();
+    }
+    DeleteError(&error);
+
+    // collect the host profiles on the wavelength grid
+    std::vector<std::unique_ptr<Profile>> wavelength_profiles;
+    std::vector<std::unique_ptr<Profile>> other_profiles;
+    std::vector<double> flux;
+    const std::size_t number_of_profiles = profiles->GetNumberOfProfiles(&error);
+    ThrowOnError(error);
+    for (std::size_t i_profile = 0; i_profile < number_of_profiles; ++i_profile)
+    {
+      std::unique_ptr<Profile> profile(profiles->GetProfileByIndex(i_profile, &error));
+      ThrowOnError(error);
+      const std::string name = profile->GetName(&error);
+      ThrowOnError(error);
+      if (ProfileGridName(name) != "wavelength")
+      {
+        // an unknown profile sized like the wavelength grid would be copied unbinned and no longer
+        // match the bins (a size shared with the height grid cannot be told apart, and is kept as is)
+        const std::size_t number_of_sections = profile->GetNumberOfSections(&error);
+        ThrowOnError(error);
+        if (number_of_sections == number_of_wavelengths && number_of_sections != number_of_heights)
+          throw std::runtime_error(
+              "Host profile '" + name +
+              "' is on the wavelength grid; only the extraterrestrial flux and surface albedo can be binned");
+        other_profiles.push_back(std::move(profile));
+        continue;
+      }
+      if (profile->GetNumberOfSections(&error) != number_of_wavelengths)
+      {
+        ThrowOnError(error);
+        throw std::runtime_error("Host profile '" + name + "' does not match the host wavelength grid");
+      }
+      if (name == "extraterrestrial flux")
+      {
+        flux.resize(number_of_wavelengths);
+        profile->GetMidpointValues(flux.data(), flux.size(), &error);
+        ThrowOnError(error);
+      }
+      wavelength_profiles.push_back(std::move(profile));
+    }
+
+    // Values are averaged over each bin with the extraterrestrial flux F_i of each host section as the
+    // weight, so that each bin keeps the flux-weighted mean; without a host flux (or where it is zero
+    // across a bin) the section widths are used instead
+    std::vector<double> weights(number_of_wavelengths);
+    for (std::size_t i = 0; i < number_of_wavelengths; ++i)
+      weights[i] = edges[i + 1] - edges[i];
+    for (std::size_t i_bin = 0; !flux.empty() && i_bin < number_of_bins; ++i_bin)
+    {
+      double total_flux = 0.0;
+      for (std::size_t i = edge_indices[i_bin]; i < edge_indices[i_bin + 1]; ++i)
+        total_flux += std::max(flux[i], 0.0);
+      if (total_flux > 0.0)
+        for (std::size_t i = edge_indices[i_bin]; i < edge_indices[i_bin + 1]; ++i)
+          weights[i] = std::max(flux[i], 0.0);
+    }
+
+    std::vector<double> bin_edges(number_of_bins + 1);
+    for (std::size_t i_edge = 0; i_edge < bin_edges.size(); ++i_edge)
+      bin_edges[i_edge] = edges[edge_indices[i_edge]];
+    std::vector<double> bin_midpoints(number_of_bins);
+    for (std::size_t i_bin = 0; i_bin < number_of_bins; ++i_bin)
+      bin_midpoints[i_bin] = 0.5 * (bin_edges[i_bin] + bin_edges[i_bin + 1]);
+    auto bins = std::make_unique<Grid>("wavelength", "nm", number_of_bins, &error);
+    ThrowOnError(error);
+    bins->SetEdges(bin_edges.data(), bin_edges.size(), &error);
+    ThrowOnError(error);
+    bins->SetMidpoints(bin_midpoints.data(), bin_midpoints.size(), &error);
+    ThrowOnError(error);
+
+    binned_grids = std::make_unique<GridMap>(&error);
+    ThrowOnError(error);
+    binned_profiles = std::make_unique<ProfileMap>(&error);
+    ThrowOnError(error);
+    binned_radiators = std::make_unique<RadiatorMap>(&error);
+    ThrowOnError(error);
+    const std::size_t number_of_grids = grids->GetNumberOfGrids(&error);
+    ThrowOnError(error);
+    for (std::size_t i_grid = 0; i_grid < number_of_grids; ++i_grid)
+    {
+      std::unique_ptr<Grid> grid(grids->GetGridByIndex(i_grid, &error));
+      ThrowOnError(error);
+      const bool is_wavelength_grid = grid->GetName(&error) == "wavelength" && grid->GetUnits(&error) == "nm";
+      ThrowOnError(error);
+      binned_grids->AddGrid(is_wavelength_grid ? bins.get() : CopyGrid(*grid).get(), &error);
+      ThrowOnError(error);
+    }
+
+    // the extraterrestrial flux is per section, so it is summed into the bins (sum F_i); other
+    // wavelength profiles x are flux-weighted means (sum F_i x_i / sum F_i)
+    for (const auto &profile : other_profiles)
+    {
+      binned_profiles->AddProfile(CopyProfile(*profile).get(), &error);
+      ThrowOnError(error);
+    }
+    for (const auto &profile : wavelength_profiles)
+    {
+      const std::string name = profile->GetName(&error);
+      const std::string units = profile->GetUnits(&error);
+      ThrowOnError(error);
+      std::vector<double> edge_values(number_of_wavelengths + 1);
+      std::vector<double> midpoint_values(number_of_wavelengths);
+      profile->GetEdgeValues(edge_values.data(), edge_values.size(), &error);
+      ThrowOnError(error);
+      profile->GetMidpointValues(midpoint_values.data(), midpoint_values.size(), &error);
+      ThrowOnError(error);
+      std::vector<double> bin_edge_values(number_of_bins + 1);
+      for (std::size_t i_edge = 0; i_edge < bin_edge_values.size(); ++i_edge)
+        bin_edge_values[i_edge] = edge_values[edge_indices[i_edge]];
+      std::vector<double> bin_midpoint_values = name == "extraterrestrial flux"
+                                                    ? SumBins(midpoint_values, edge_indices)
+                                                    : WeightedBinMeans(midpoint_values, weights, edge_indices);
+      Profile binned(name.c_str(), units.c_str(), bins.get(), &error);
+      ThrowOnError(error);
+      binned.SetEdgeValues(bin_edge_values.data(), bin_edge_values.size(), &error);
+      ThrowOnError(error);
+      binned.SetMidpointValues(bin_midpoint_values.data(), bin_midpoint_values.size(), &error);
+      ThrowOnError(error);
+      binned_profiles->AddProfile(&binned, &error);
+      ThrowOnError(error);
+    }
+
+    // Radiators keep the flux-weighted extinction, scattering, and asymmetry of each bin:
+    //   tau = sum F_i tau_i / sum F_i
+    //   omega = sum F_i tau_i omega_i / sum F_i tau_i
+    //   g = sum F_i tau_i omega_i g_i / sum F_i tau_i omega_i
+    const std::size_t number_of_radiators = radiators->GetNumberOfRadiators(&error);
+    ThrowOnError(error);
+    if (number_of_radiators == 0)
+    {
+      DeleteError(&error);
+      return;
+    }
+    if (heights == nullptr)
+    {
+      DeleteError(&error);
+      throw std::runtime_error("Host radiators require the host to supply the height grid (height, km)");
+    }
+    const std::size_t number_of_layers = number_of_heights;
+    for (std::size_t i_radiator = 0; i_radiator < number_of_radiators; ++i_radiator)
+    {
+      std::unique_ptr<Radiator> radiator(radiators->GetRadiatorByIndex(i_radiator, &error));
+      ThrowOnError(error);
+      const std::string name = radiator->GetName(&error);
+      ThrowOnError(error);
+      const std::size_t size = number_of_wavelengths * number_of_layers;
+      std::vector<double> optical_depths(size);
+      std::vector<double> single_scattering_albedos(size);
+      std::vector<double> asymmetry_factors(size);
+      radiator->GetOpticalDepths(optical_depths.data(), number_of_layers, number_of_wavelengths, &error);
+      ThrowOnError(error);
+      radiator->GetSingleScatteringAlbedos(
+          single_scattering_albedos.data(), number_of_layers, number_of_wavelengths, &error);
+      ThrowOnError(error);
+      radiator->GetAsymmetryFactors(asymmetry_factors.data(), number_of_layers, number_of_wavelengths, 1, &error);
+      ThrowOnError(error);
+      const std::size_t binned_size = number_of_bins * number_of_layers;
+      std::vector<double> binned_optical_depths(binned_size);
+      std::vector<double> binned_single_scattering_albedos(binned_size);
+      std::vector<double> binned_asymmetry_factors(binned_size);
+      std::vector<double> tau(number_of_wavelengths);
+      std::vector<double> omega(number_of_wavelengths);
+      std::vector<double> g(number_of_wavelengths);
+      std::vector<double> extinction_weights(number_of_wavelengths);
+      std::vector<double> scattering_weights(number_of_wavelengths);
+      for (std::size_t i_layer = 0; i_layer < number_of_layers; ++i_layer)
+      {
+        // values are (wavelength, layer)
+        for (std::size_t i = 0; i < number_of_wavelengths; ++i)
+        {
+          tau[i] = optical_depths[i * number_of_layers + i_layer];
+          omega[i] = single_scattering_albedos[i * number_of_layers + i_layer];
+          g[i] = asymmetry_factors[i * number_of_layers + i_layer];
+          extinction_weights[i] = weights[i] * tau[i];
+          scattering_weights[i] = extinction_weights[i] * omega[i];
+        }
+        const std::vector<double> binned_tau = WeightedBinMeans(tau, weights, edge_indices);
+        const std::vector<double> binned_omega = WeightedBinMeans(omega, extinction_weights, edge_indices);
+        const std::vector<double> binned_g = WeightedBinMeans(g, scattering_weights, edge_indices);
+        for (std::size_t i_bin = 0; i_bin < number_of_bins; ++i_bin)
+        {
+          binned_optical_depths[i_bin * number_of_layers + i_layer] = binned_tau[i_bin];
+          binned_single_scattering_albedos[i_bin * number_of_layers + i_layer] = binned_omega[i_bin];
+          binned_asymmetry_factors[i_bin * number_of_layers + i_layer] = binned_g[i_bin];
+        }
+      }
+      Radiator binned(name.c_str(), heights.get(), bins.get(), &error);
+      ThrowOnError(error);
+      binned.SetOpticalDepths(binned_optical_depths.data(), number_of_layers, number_of_bins, &error);
+      ThrowOnError(error);
+      binned.SetSingleScatteringAlbedos(binned_single_scattering_albedos.data(), number_of_layers, number_of_bins, &error);
+      ThrowOnError(error);
+      binned.SetAsymmetryFactors(binned_asymmetry_factors.data(), number_of_layers, number_of_bins, 1, &error);
+      ThrowOnError(error);
+      binned_radiators->AddRadiator(&binned, &error);
+      ThrowOnError(error);
+    }
+    DeleteError(&error);
+  }
+
+  void TUVX::SetWavelengthBins(const std::vector<double> &bin_edges)
+  {
+    wavelength_bin_edges_ = bin_edges;
+  }
+
   GridMap *TUVX::GetGridMap(Error *error)
   {
     int error_code = 0;
@@ -211,8 +648,26 @@ namespace musica
       double *const spectral_irradiance,
       Error *const error)
   {
+    DeleteError(error);
     int error_code = 0;
     const double sza_degrees = solar_zenith_angle * 180.0 / std::numbers::pi;
+    const bool is_dark = IsDark(solar_zenith_angle, error);
+    if (!IsSuccess(*error))
+      return;
+    if (is_dark)
+    {
+      try
+      {
+        FillDarkColumn(photolysis_rate_constants, heating_rates, dose_rates, actinic_flux, spectral_irradiance);
+      }
+      catch (const std::exception &e)
+      {
+        ToError(e, MUSICA_SEVERITY_ERROR, error);
+        return;
+      }
+      NoError(error);
+      return;
+    }
     try
     {
       InternalRunTuvx(
@@ -243,6 +698,470 @@ namespace musica
       ToError(MUSICA_ERROR_CATEGORY, 1, "Failed to run TUV-x", MUSICA_SEVERITY_CRITICAL, error);
       return;
     }
+    NoError(error);
+  }
+
+  void TUVX::UpdateColumn(
+      const std::size_t column,
+      const std::vector<ColumnProfile> &column_profiles,
+      const std::vector<ColumnRadiator> &column_radiators,
+      Error *const error)
+  {
+    DeleteError(error);
+    std::vector<InternalProfileUpdate> profile_updates;
+    std::vector<InternalRadiatorUpdate> radiator_updates;
+    if (!PackColumnUpdates(column_profiles, column_radiators, profile_updates, radiator_updates, error))
+      return;
+    int error_code = 0;
+    InternalUpdateColumn(
+        profile_updates.data(),
+        profile_updates.size(),
+        radiator_updates.data(),
+        radiator_updates.size(),
+        column,
+        &error_code);
+    if (error_code != 0)
+    {
+      ToError(MUSICA_ERROR_CATEGORY, error_code, "Failed to update TUV-x column", MUSICA_SEVERITY_ERROR, error);
+      return;
+    }
+    NoError(error);
+  }
+
+  bool TUVX::PackColumnUpdates(
+      const std::vector<ColumnProfile> &column_profiles,
+      const std::vector<ColumnRadiator> &column_radiators,
+      std::vector<InternalProfileUpdate> &profile_updates,
+      std::vector<InternalRadiatorUpdate> &radiator_updates,
+      Error *const error)
+  {
+    profile_updates.clear();
+    profile_updates.reserve(column_profiles.size());
+    for (const auto &column_profile : column_profiles)
+    {
+      if (column_profile.profile == nullptr || column_profile.profile->updater_ == nullptr)
+      {
+        ToError(MUSICA_ERROR_CATEGORY, 1, "Column profile is not set", MUSICA_SEVERITY_ERROR, error);
+        return false;
+      }
+      profile_updates.push_back({ column_profile.profile->updater_,
+                                  column_profile.edge_values,
+                                  column_profile.midpoint_values,
+                                  column_profile.layer_densities });
+    }
+    radiator_updates.clear();
+    radiator_updates.reserve(column_radiators.size());
+    for (const auto &column_radiator : column_radiators)
+    {
+      if (column_radiator.radiator == nullptr || column_radiator.radiator->updater_ == nullptr)
+      {
+        ToError(MUSICA_ERROR_CATEGORY, 1, "Column radiator is not set", MUSICA_SEVERITY_ERROR, error);
+        return false;
+      }
+      radiator_updates.push_back({ column_radiator.radiator->updater_,
+                                   column_radiator.optical_depths,
+                                   column_radiator.single_scattering_albedos,
+                                   column_radiator.asymmetry_factors });
+    }
+    return true;
+  }
+
+  void TUVX::RunColumns(
+      const std::size_t number_of_columns,
+      const double *const solar_zenith_angles,
+      const double *const earth_sun_distances,
+      const std::vector<ColumnProfile> &column_profiles,
+      const std::vector<ColumnRadiator> &column_radiators,
+      double *const photolysis_rate_constants,
+      double *const heating_rates,
+      double *const dose_rates,
+      double *const actinic_flux,
+      double *const spectral_irradiance,
+      Error *const error)
+  {
+    DeleteError(error);
+    std::size_t number_of_edges = static_cast<std::size_t>(this->number_of_height_midpoints_) + 1;
+    std::size_t photolysis_stride = 0;
+    std::size_t heating_stride = 0;
+    std::size_t dose_stride = 0;
+    std::size_t radiation_field_stride =
+        3 * number_of_edges * static_cast<std::size_t>(this->number_of_wavelength_midpoints_);
+    try
+    {
+      photolysis_stride = number_of_edges * static_cast<std::size_t>(GetPhotolysisRateConstantCount());
+      heating_stride = number_of_edges * static_cast<std::size_t>(GetHeatingRateCount());
+      if (dose_rates != nullptr)
+        dose_stride = number_of_edges * static_cast<std::size_t>(GetDoseRateCount());
+    }
+    catch (const std::exception &e)
+    {
+      ToError(e, MUSICA_SEVERITY_ERROR, error);
+      return;
+    }
+
+    // resolve the profile and radiator updaters once for the whole batch
+    std::vector<InternalProfileUpdate> profile_updates;
+    std::vector<InternalRadiatorUpdate> radiator_updates;
+    if (!PackColumnUpdates(column_profiles, column_radiators, profile_updates, radiator_updates, error))
+      return;
+
+    for (std::size_t i_column = 0; i_column < number_of_columns; ++i_column)
+    {
+      double *const column_photolysis_rate_constants =
+          photolysis_rate_constants == nullptr ? nullptr : photolysis_rate_constants + i_column * photolysis_stride;
+      double *const column_heating_rates = heating_rates == nullptr ? nullptr : heating_rates + i_column * heating_stride;
+      double *const column_dose_rates = dose_rates == nullptr ? nullptr : dose_rates + i_column * dose_stride;
+      double *const column_actinic_flux =
+          actinic_flux == nullptr ? nullptr : actinic_flux + i_column * radiation_field_stride;
+      double *const column_spectral_irradiance =
+          spectral_irradiance == nullptr ? nullptr : spectral_irradiance + i_column * radiation_field_stride;
+
+      // dark columns are zero-filled without updating their profiles
+      const bool is_dark = IsDark(solar_zenith_angles[i_column], error);
+      if (!IsSuccess(*error))
+        return;
+      if (is_dark)
+      {
+        try
+        {
+          FillDarkColumn(
+              column_photolysis_rate_constants,
+              column_heating_rates,
+              column_dose_rates,
+              column_actinic_flux,
+              column_spectral_irradiance);
+        }
+        catch (const std::exception &e)
+        {
+          ToError(e, MUSICA_SEVERITY_ERROR, error);
+          return;
+        }
+        continue;
+      }
+      if (!profile_updates.empty() || !radiator_updates.empty())
+      {
+        int error_code = 0;
+        InternalUpdateColumn(
+            profile_updates.data(),
+            profile_updates.size(),
+            radiator_updates.data(),
+            radiator_updates.size(),
+            i_column,
+            &error_code);
+        if (error_code != 0)
+        {
+          ToError(MUSICA_ERROR_CATEGORY, error_code, "Failed to update TUV-x column", MUSICA_SEVERITY_ERROR, error);
+          return;
+        }
+      }
+      Run(solar_zenith_angles[i_column],
+          earth_sun_distances[i_column],
+          column_photolysis_rate_constants,
+          column_heating_rates,
+          column_dose_rates,
+          column_actinic_flux,
+          column_spectral_irradiance,
+          error);
+      if (!IsSuccess(*error))
+        return;
+    }
+    NoError(error);
+  }
+
+  void TUVX::SetNightThreshold(const double night_threshold)
+  {
+    night_threshold_ = night_threshold;
+  }
+
+  double TUVX::GetNightThreshold(Error *const error)
+  {
+    DeleteError(error);
+    if (night_threshold_ >= 0.0)
+    {
+      NoError(error);
+      return night_threshold_;
+    }
+    if (default_night_threshold_ >= 0.0)
+    {
+      NoError(error);
+      return default_night_threshold_;
+    }
+
+    // The sun sets at the top of the height grid when it falls below the horizon seen from there,
+    // measured from the surface of a spherical Earth at the bottom of the grid (as in TUV-x).
+    constexpr double earth_radius = 6371.0;  // [km]
+    std::unique_ptr<GridMap> grids(GetGridMap(error));
+    if (!IsSuccess(*error))
+      return 0.0;
+    std::unique_ptr<Grid> heights(grids->GetGrid("height", "km", error));
+    if (!IsSuccess(*error))
+      return 0.0;
+    const std::size_t n_sections = heights->GetNumberOfSections(error);
+    if (!IsSuccess(*error))
+      return 0.0;
+    const double *edges = heights->GetEdgesPointer(error);
+    if (!IsSuccess(*error))
+      return 0.0;
+    const double surface_radius = earth_radius + edges[0];
+    default_night_threshold_ =
+        std::numbers::pi / 2.0 + std::acos(surface_radius / (surface_radius + edges[n_sections] - edges[0]));
+    NoError(error);
+    return default_night_threshold_;
+  }
+
+  bool TUVX::IsDark(const double solar_zenith_angle, Error *const error)
+  {
+    // with the default threshold the column can only be dark with the sun below the horizon
+    if (night_threshold_ < 0.0 && solar_zenith_angle <= std::numbers::pi / 2.0)
+      return false;
+    const double night_threshold = GetNightThreshold(error);
+    return IsSuccess(*error) && solar_zenith_angle >= night_threshold;
+  }
+
+  void TUVX::FillDarkColumn(
+      double *const photolysis_rate_constants,
+      double *const heating_rates,
+      double *const dose_rates,
+      double *const actinic_flux,
+      double *const spectral_irradiance)
+  {
+    const std::size_t number_of_edges = static_cast<std::size_t>(this->number_of_height_midpoints_) + 1;
+    const std::size_t radiation_field_size =
+        3 * number_of_edges * static_cast<std::size_t>(this->number_of_wavelength_midpoints_);
+    if (photolysis_rate_constants != nullptr)
+      std::fill_n(photolysis_rate_constants, number_of_edges * GetPhotolysisRateConstantCount(), 0.0);
+    if (heating_rates != nullptr)
+      std::fill_n(heating_rates, number_of_edges * GetHeatingRateCount(), 0.0);
+    if (dose_rates != nullptr)
+      std::fill_n(dose_rates, number_of_edges * GetDoseRateCount(), 0.0);
+    if (actinic_flux != nullptr)
+      std::fill_n(actinic_flux, radiation_field_size, 0.0);
+    if (spectral_irradiance != nullptr)
+      std::fill_n(spectral_irradiance, radiation_field_size, 0.0);
+  }
+
+  void TUVX::CreatePhotolysisLookupTable(const std::vector<double> &solar_zenith_angles, Error *const error)
+  {
+    CreatePhotolysisLookupTable(solar_zenith_angles, nullptr, {}, error);
+  }
+
+  void TUVX::CreatePhotolysisLookupTable(
+      const std::vector<double> &solar_zenith_angles,
+      Profile *ozone,
+      const std::vector<double> &ozone_columns,
+      Error *const error)
+  {
+    DeleteError(error);
+    lookup_solar_zenith_angles_.clear();
+    lookup_ozone_columns_.clear();
+    lookup_photolysis_rate_constants_.clear();
+    if (solar_zenith_angles.empty() || !IsStrictlyIncreasing(solar_zenith_angles))
+    {
+      ToError(
+          MUSICA_ERROR_CATEGORY,
+          1,
+          "Lookup table solar zenith angles must be non-empty and strictly increasing",
+          MUSICA_SEVERITY_ERROR,
+          error);
+      return;
+    }
+    if (ozone != nullptr && (ozone_columns.empty() || !IsStrictlyIncreasing(ozone_columns)))
+    {
+      ToError(
+          MUSICA_ERROR_CATEGORY,
+          1,
+          "Lookup table ozone columns must be non-empty and strictly increasing",
+          MUSICA_SEVERITY_ERROR,
+          error);
+      return;
+    }
+    std::size_t photolysis_size = 0;
+    try
+    {
+      photolysis_size =
+          (static_cast<std::size_t>(this->number_of_height_midpoints_) + 1) * GetPhotolysisRateConstantCount();
+    }
+    catch (const std::exception &e)
+    {
+      ToError(e, MUSICA_SEVERITY_ERROR, error);
+      return;
+    }
+
+    std::vector<double> table;
+    auto tabulate_solar_zenith_angles = [&]()
+    {
+      for (const double solar_zenith_angle : solar_zenith_angles)
+      {
+        table.resize(table.size() + photolysis_size);
+        Run(solar_zenith_angle,
+            1.0,
+            table.data() + table.size() - photolysis_size,
+            nullptr,
+            nullptr,
+            nullptr,
+            nullptr,
+            error);
+        if (!IsSuccess(*error))
+          return false;
+      }
+      return true;
+    };
+
+    if (ozone == nullptr)
+    {
+      if (!tabulate_solar_zenith_angles())
+        return;
+    }
+    else
+    {
+      // save the current ozone profile so it can be scaled to each tabulated column and restored
+      const std::size_t n_sections = ozone->GetNumberOfSections(error);
+      if (!IsSuccess(*error))
+        return;
+      std::vector<double> edge_values(n_sections + 1);
+      std::vector<double> midpoint_values(n_sections);
+      std::vector<double> layer_densities(n_sections);
+      ozone->GetEdgeValues(edge_values.data(), edge_values.size(), error);
+      if (!IsSuccess(*error))
+        return;
+      ozone->GetMidpointValues(midpoint_values.data(), midpoint_values.size(), error);
+      if (!IsSuccess(*error))
+        return;
+      ozone->GetLayerDensities(layer_densities.data(), layer_densities.size(), error);
+      if (!IsSuccess(*error))
+        return;
+      const double exo_layer_density = ozone->GetExoLayerDensity(error);
+      if (!IsSuccess(*error))
+        return;
+      // TUV-x folds the exo layer density into the top layer density, so the layer densities
+      // already sum to the total column; the top layer is unfolded so it can be scaled and reset
+      double reference_column = 0.0;
+      for (const double density : layer_densities)
+        reference_column += density;
+      if (!layer_densities.empty())
+        layer_densities.back() -= exo_layer_density;
+      if (reference_column <= 0.0)
+      {
+        ToError(
+            MUSICA_ERROR_CATEGORY,
+            1,
+            "Ozone profile must have a positive column to be scaled",
+            MUSICA_SEVERITY_ERROR,
+            error);
+        return;
+      }
+
+      auto set_ozone = [&](const double scale_factor)
+      {
+        std::vector<double> scaled_edges(edge_values);
+        std::vector<double> scaled_midpoints(midpoint_values);
+        std::vector<double> scaled_densities(layer_densities);
+        for (double &value : scaled_edges)
+          value *= scale_factor;
+        for (double &value : scaled_midpoints)
+          value *= scale_factor;
+        for (double &value : scaled_densities)
+          value *= scale_factor;
+        ozone->SetEdgeValues(scaled_edges.data(), scaled_edges.size(), error);
+        if (IsSuccess(*error))
+          ozone->SetMidpointValues(scaled_midpoints.data(), scaled_midpoints.size(), error);
+        if (IsSuccess(*error))
+          ozone->SetLayerDensities(scaled_densities.data(), scaled_densities.size(), error);
+        if (IsSuccess(*error))
+          ozone->SetExoLayerDensity(exo_layer_density * scale_factor, error);
+        return IsSuccess(*error);
+      };
+
+      bool success = true;
+      for (const double ozone_column : ozone_columns)
+      {
+        success = set_ozone(ozone_column / reference_column) && tabulate_solar_zenith_angles();
+        if (!success)
+          break;
+      }
+      if (!success)
+      {
+        // restore the original profile without losing the original error
+        Error restore_error;
+        std::swap(*error, restore_error);
+        set_ozone(1.0);
+        std::swap(*error, restore_error);
+        DeleteError(&restore_error);
+        return;
+      }
+      if (!set_ozone(1.0))
+        return;
+      lookup_ozone_columns_ = ozone_columns;
+    }
+    lookup_solar_zenith_angles_ = solar_zenith_angles;
+    lookup_photolysis_rate_constants_ = std::move(table);
+    NoError(error);
+  }
+
+  bool TUVX::HasPhotolysisLookupTable() const
+  {
+    return !lookup_solar_zenith_angles_.empty();
+  }
+
+  void TUVX::RunFromLookupTable(
+      const double solar_zenith_angle,
+      const double earth_sun_distance,
+      double *const photolysis_rate_constants,
+      Error *const error)
+  {
+    DeleteError(error);
+    if (!lookup_ozone_columns_.empty())
+    {
+      ToError(
+          MUSICA_ERROR_CATEGORY,
+          1,
+          "Photolysis lookup table has an ozone column dimension; an ozone column must be provided",
+          MUSICA_SEVERITY_ERROR,
+          error);
+      return;
+    }
+    RunFromLookupTable(solar_zenith_angle, earth_sun_distance, 0.0, photolysis_rate_constants, error);
+  }
+
+  void TUVX::RunFromLookupTable(
+      const double solar_zenith_angle,
+      const double earth_sun_distance,
+      const double ozone_column,
+      double *const photolysis_rate_constants,
+      Error *const error)
+  {
+    DeleteError(error);
+    if (!HasPhotolysisLookupTable())
+    {
+      ToError(MUSICA_ERROR_CATEGORY, 1, "Photolysis lookup table has not been created", MUSICA_SEVERITY_ERROR, error);
+      return;
+    }
+    const std::size_t n_angles = lookup_solar_zenith_angles_.size();
+    const std::size_t photolysis_size = lookup_photolysis_rate_constants_.size() /
+                                        (n_angles * std::max<std::size_t>(lookup_ozone_columns_.size(), 1));
+    const auto [i_angle, angle_weight] = Bracket(lookup_solar_zenith_angles_, solar_zenith_angle);
+    std::size_t i_ozone = 0;
+    double ozone_weight = 0.0;
+    if (!lookup_ozone_columns_.empty())
+      std::tie(i_ozone, ozone_weight) = Bracket(lookup_ozone_columns_, ozone_column);
+    const std::size_t next_angle = std::min(i_angle + 1, n_angles - 1);
+    const std::size_t next_ozone = std::min(i_ozone + 1, std::max<std::size_t>(lookup_ozone_columns_.size(), 1) - 1);
+
+    // rate constants were tabulated at 1 AU and scale with the inverse square of the Earth-Sun distance
+    const double distance_factor = 1.0 / (earth_sun_distance * earth_sun_distance);
+    auto entry = [&](std::size_t i_o, std::size_t i_a)
+    { return lookup_photolysis_rate_constants_.data() + (i_o * n_angles + i_a) * photolysis_size; };
+    const double *low_low = entry(i_ozone, i_angle);
+    const double *low_high = entry(i_ozone, next_angle);
+    const double *high_low = entry(next_ozone, i_angle);
+    const double *high_high = entry(next_ozone, next_angle);
+    for (std::size_t i = 0; i < photolysis_size; ++i)
+    {
+      const double low = low_low[i] + angle_weight * (low_high[i] - low_low[i]);
+      const double high = high_low[i] + angle_weight * (high_high[i] - high_low[i]);
+      photolysis_rate_constants[i] = distance_factor * (low + ozone_weight * (high - low));
+    }
+    NoError(error);
   }
 
   int TUVX::GetPhotolysisRateConstantCount()
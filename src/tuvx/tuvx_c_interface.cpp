@@ -98,6 +98,61 @@ namespace musica
           error);
     }
 
+    void SetTuvxNightThreshold(TUVX *tuvx, const double night_threshold, Error *error)
+    {
+      DeleteError(error);
+      tuvx->SetNightThreshold(night_threshold);
+      NoError(error);
+    }
+
+    void RunTuvxColumns(
+        TUVX *const tuvx,
+        const std::size_t number_of_columns,
+        const double *const solar_zenith_angles,
+        const double *const earth_sun_distances,
+        const ColumnProfile *const column_profiles,
+        const std::size_t number_of_column_profiles,
+        const ColumnRadiator *const column_radiators,
+        const std::size_t number_of_column_radiators,
+        double *const photolysis_rate_constants,
+        double *const heating_rates,
+        double *const dose_rates,
+        double *const actinic_flux,
+        double *const spectral_irradiance,
+        Error *const error)
+    {
+      DeleteError(error);
+      std::vector<ColumnProfile> profiles(column_profiles, column_profiles + number_of_column_profiles);
+      std::vector<ColumnRadiator> radiators(column_radiators, column_radiators + number_of_column_radiators);
+      tuvx->RunColumns(
+          number_of_columns,
+          solar_zenith_angles,
+          earth_sun_distances,
+          profiles,
+          radiators,
+          photolysis_rate_constants,
+          heating_rates,
+          dose_rates,
+          actinic_flux,
+          spectral_irradiance,
+          error);
+    }
+
+    void UpdateTuvxColumn(
+        TUVX *const tuvx,
+        const std::size_t column,
+        const ColumnProfile *const column_profiles,
+        const std::size_t number_of_column_profiles,
+        const ColumnRadiator *const column_radiators,
+        const std::size_t number_of_column_radiators,
+        Error *const error)
+    {
+      DeleteError(error);
+      std::vector<ColumnProfile> profiles(column_profiles, column_profiles + number_of_column_profiles);
+      std::vector<ColumnRadiator> radiators(column_radiators, column_radiators + number_of_column_radiators);
+      tuvx->UpdateColumn(column, profiles, radiators, error);
+    }
+
     void TuvxVersion(String *tuvx_version)
     {
       CreateString(TUVX::GetVersion().c_str(), tuvx_version);